@@ -0,0 +1,203 @@
+#include "utility.h"
+
+#include <unf/broker.h>
+#include <unf/notice.h>
+
+#include <benchmark/benchmark.h>
+#include <pxr/usd/usd/stage.h>
+#include <tbb/task_arena.h>
+
+#include <cstdint>
+#include <vector>
+
+// Measure broker creation while the process holds many stages.
+static void BM_BrokerCreate(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    std::vector<PXR_NS::UsdStageRefPtr> stages;
+    stages.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        stages.push_back(PXR_NS::UsdStage::CreateInMemory());
+    }
+
+    for (auto _ : state) {
+        for (const auto& stage : stages) {
+            benchmark::DoNotOptimize(unf::Broker::Create(stage));
+        }
+
+        state.PauseTiming();
+        unf::Broker::ResetAll();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_BrokerCreate)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+
+// Measure notice emission via the broker outside of a transaction.
+static void BM_BrokerSend(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+    auto notices = Bench::CreateStageContentsChangedNotices(size);
+
+    for (auto _ : state) {
+        for (const auto& notice : notices) {
+            broker->Send(notice);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_BrokerSend)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+// Measure notice capture via the broker within a transaction.
+static void BM_BrokerCapture(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto notices = Bench::CreateStageContentsChangedNotices(size);
+        broker->BeginTransaction();
+        state.ResumeTiming();
+
+        for (const auto& notice : notices) {
+            broker->Send(notice);
+        }
+
+        state.PauseTiming();
+        broker->EndTransaction();
+        notices.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_BrokerCapture)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+// Measure the end of a transaction (merge, post-process and send) for
+// StageContentsChanged notices.
+static void BM_BrokerEndTransaction_StageContentsChanged(
+    benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto notices = Bench::CreateStageContentsChangedNotices(size);
+        broker->BeginTransaction();
+        for (const auto& notice : notices) {
+            broker->Send(notice);
+        }
+        notices.clear();
+        state.ResumeTiming();
+
+        broker->EndTransaction();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_BrokerEndTransaction_StageContentsChanged)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+// Measure the end of a transaction (merge, post-process and send) for
+// ObjectsChanged notices.
+static void BM_BrokerEndTransaction_ObjectsChanged(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto notices = Bench::CreateObjectsChangedNotices(size);
+        broker->BeginTransaction();
+        for (const auto& notice : notices) {
+            broker->Send(notice);
+        }
+        notices.clear();
+        state.ResumeTiming();
+
+        broker->EndTransaction();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_BrokerEndTransaction_ObjectsChanged)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 16)
+    ->Unit(benchmark::kMillisecond);
+
+// Measure the end of a transaction for ObjectsChanged notices when the
+// broker can use a limited number of threads, to show how the parallel
+// reduction of notices scales across cores.
+static void BM_BrokerEndTransaction_ObjectsChangedScaling(
+    benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    const int threads = static_cast<int>(state.range(1));
+
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+
+    tbb::task_arena arena(threads);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto notices = Bench::CreateObjectsChangedNotices(size);
+        broker->BeginTransaction();
+        for (const auto& notice : notices) {
+            broker->Send(notice);
+        }
+        notices.clear();
+        state.ResumeTiming();
+
+        arena.execute([&]() { broker->EndTransaction(); });
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["threads"] = threads;
+    broker->Reset();
+}
+
+// Register number of notices and number of threads for scaling benchmarks,
+// up to the two million notices produced by a large batch import.
+static void ScalingArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t size : {1 << 16, 1 << 18, 1 << 21}) {
+        for (int64_t threads : {1, 2, 4, 8, 16}) {
+            benchmark->Args({size, threads});
+        }
+    }
+}
+
+BENCHMARK(BM_BrokerEndTransaction_ObjectsChangedScaling)
+    ->Apply(ScalingArguments)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
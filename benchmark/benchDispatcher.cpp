@@ -0,0 +1,75 @@
+#include "utility.h"
+
+#include <unf/broker.h>
+
+#include <benchmark/benchmark.h>
+#include <pxr/usd/usd/stage.h>
+
+// Measure stage edits without any broker as a reference for the
+// conversion overhead.
+static void BM_StageEdit_Baseline(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = Bench::CreateStage(size);
+
+    int value = 0;
+    for (auto _ : state) {
+        Bench::EditPrims(stage, size, value++);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_StageEdit_Baseline)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+// Measure stage edits converted into standalone notices by the
+// StageDispatcher.
+static void BM_StageEdit_StageDispatcher(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = Bench::CreateStage(size);
+    auto broker = unf::Broker::Create(stage);
+
+    int value = 0;
+    for (auto _ : state) {
+        Bench::EditPrims(stage, size, value++);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_StageEdit_StageDispatcher)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+// Measure stage edits converted into standalone notices by the
+// StageDispatcher and captured within a transaction.
+static void BM_StageEdit_StageDispatcherTransaction(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = Bench::CreateStage(size);
+    auto broker = unf::Broker::Create(stage);
+
+    int value = 0;
+    for (auto _ : state) {
+        broker->BeginTransaction();
+        Bench::EditPrims(stage, size, value++);
+        broker->EndTransaction();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_StageEdit_StageDispatcherTransaction)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
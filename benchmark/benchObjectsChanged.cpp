@@ -0,0 +1,79 @@
+#include "utility.h"
+
+#include <unf/broker.h>
+#include <unf/notice.h>
+
+#include <benchmark/benchmark.h>
+#include <pxr/usd/usd/prim.h>
+
+#include <utility>
+#include <vector>
+
+// Measure the consolidation of ObjectsChanged notices, each one recording a
+// change on a distinct prim.
+static void BM_ObjectsChangedMerge(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto notices = Bench::CreateObjectsChangedNotices(size);
+        state.ResumeTiming();
+
+        auto& notice = notices.at(0);
+        for (size_t i = 1; i < notices.size(); ++i) {
+            notice->Merge(std::move(*notices[i]));
+        }
+
+        state.PauseTiming();
+        notices.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ObjectsChangedMerge)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+// Measure queries for each prim of a stage against a notice recording
+// changes on half of the prims.
+static void BM_ObjectsChangedAffectedObject(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto stage = Bench::CreateStage(size);
+    auto broker = unf::Broker::Create(stage);
+
+    Bench::Collector<unf::UnfNotice::ObjectsChanged> collector(stage);
+    Bench::EditPrims(stage, size / 2, 0);
+
+    const auto& notice = dynamic_cast<const unf::UnfNotice::ObjectsChanged&>(
+        *collector.GetNotices().at(0));
+
+    std::vector<PXR_NS::UsdPrim> prims;
+    prims.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        prims.push_back(stage->GetPrimAtPath(Bench::GetPrimPath(i)));
+    }
+
+    for (auto _ : state) {
+        size_t count = 0;
+        for (const auto& prim : prims) {
+            count += notice.AffectedObject(prim);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    broker->Reset();
+}
+
+BENCHMARK(BM_ObjectsChangedAffectedObject)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+bool HasArgument(int argc, char** argv, const char* prefix)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], prefix, std::strlen(prefix)) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<char*> arguments(argv, argv + argc);
+
+    // Record results as JSON by default so that runs can be compared
+    // between releases.
+    char output[] = "--benchmark_out=unf_bench.json";
+    char outputFormat[] = "--benchmark_out_format=json";
+
+    if (!HasArgument(argc, argv, "--benchmark_out=")) {
+        arguments.push_back(output);
+    }
+    if (!HasArgument(argc, argv, "--benchmark_out_format=")) {
+        arguments.push_back(outputFormat);
+    }
+
+    int count = static_cast<int>(arguments.size());
+    benchmark::Initialize(&count, arguments.data());
+
+    if (benchmark::ReportUnrecognizedArguments(count, arguments.data())) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
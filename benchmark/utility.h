@@ -0,0 +1,141 @@
+#ifndef BENCHMARK_USD_NOTICE_FRAMEWORK_UTILITY_H
+#define BENCHMARK_USD_NOTICE_FRAMEWORK_UTILITY_H
+
+#include <unf/broker.h>
+#include <unf/notice.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+// Return path of prim authored at 'index' by CreateStage.
+inline PXR_NS::SdfPath GetPrimPath(size_t index)
+{
+    return PXR_NS::SdfPath("/Root/Prim" + std::to_string(index));
+}
+
+// Create in-memory stage with 'size' prims.
+inline PXR_NS::UsdStageRefPtr CreateStage(size_t size)
+{
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+
+    PXR_NS::SdfChangeBlock block;
+    for (size_t i = 0; i < size; ++i) {
+        stage->DefinePrim(GetPrimPath(i));
+    }
+
+    return stage;
+}
+
+// Author metadata on 'size' prims within a single change block so that
+// one PXR_NS::UsdNotice::ObjectsChanged notice is emitted.
+inline void EditPrims(
+    const PXR_NS::UsdStageRefPtr& stage, size_t size, int value)
+{
+    static const PXR_NS::TfToken comment("comment");
+    const std::string text = std::to_string(value);
+
+    PXR_NS::SdfChangeBlock block;
+    for (size_t i = 0; i < size; ++i) {
+        stage->GetPrimAtPath(GetPrimPath(i)).SetMetadata(comment, text);
+    }
+}
+
+// Record copies of standalone notices received for a stage.
+template <class T>
+class Collector : public PXR_NS::TfWeakBase {
+  public:
+    Collector(const PXR_NS::UsdStageWeakPtr& stage)
+    {
+        auto self = PXR_NS::TfCreateWeakPtr(this);
+        _key = PXR_NS::TfNotice::Register(
+            self, &Collector::_OnReceiving, stage);
+    }
+
+    virtual ~Collector() { PXR_NS::TfNotice::Revoke(_key); }
+
+    const std::vector<unf::UnfNotice::StageNoticeRefPtr>& GetNotices() const
+    {
+        return _notices;
+    }
+
+  private:
+    void _OnReceiving(const T& notice, const PXR_NS::UsdStageWeakPtr&)
+    {
+        _notices.push_back(notice.Clone());
+    }
+
+    std::vector<unf::UnfNotice::StageNoticeRefPtr> _notices;
+    PXR_NS::TfNotice::Key _key;
+};
+
+// Return 'size' StageContentsChanged notices.
+inline std::vector<unf::UnfNotice::StageNoticeRefPtr>
+CreateStageContentsChangedNotices(size_t size)
+{
+    static auto stage = PXR_NS::UsdStage::CreateInMemory();
+    PXR_NS::UsdNotice::StageContentsChanged notice(stage);
+
+    std::vector<unf::UnfNotice::StageNoticeRefPtr> notices;
+    notices.reserve(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        notices.push_back(
+            unf::UnfNotice::StageContentsChanged::Create(notice));
+    }
+
+    return notices;
+}
+
+// Return 'size' ObjectsChanged notices, each one recording a metadata change
+// on a distinct prim.
+//
+// Notices are generated from authoring a stage once per size and copies
+// are returned so that they can be consumed by merge operations.
+inline std::vector<unf::UnfNotice::StageNoticeRefPtr>
+CreateObjectsChangedNotices(size_t size)
+{
+    static std::map<size_t, std::vector<unf::UnfNotice::StageNoticeRefPtr> >
+        cache;
+
+    if (cache.find(size) == cache.end()) {
+        static const PXR_NS::TfToken comment("comment");
+
+        auto stage = CreateStage(size);
+        auto broker = unf::Broker::Create(stage);
+
+        Collector<unf::UnfNotice::ObjectsChanged> collector(stage);
+        for (size_t i = 0; i < size; ++i) {
+            stage->GetPrimAtPath(GetPrimPath(i)).SetMetadata(comment, "test");
+        }
+
+        cache[size] = collector.GetNotices();
+        broker->Reset();
+    }
+
+    std::vector<unf::UnfNotice::StageNoticeRefPtr> notices;
+    notices.reserve(size);
+
+    for (const auto& notice : cache.at(size)) {
+        notices.push_back(notice->Clone());
+    }
+
+    return notices;
+}
+
+}  // namespace Bench
+
+#endif  // BENCHMARK_USD_NOTICE_FRAMEWORK_UTILITY_H
@@ -7,6 +7,7 @@
 #     usd::plug
 #     usd::arch
 #     usd::vt
+#     usd::trace
 #
 # Usage:
 #     find_package(USD)
@@ -38,7 +39,7 @@ find_path(
         include
 )
 
-set(USD_LIBRARIES usd sdf tf plug arch vt)
+set(USD_LIBRARIES usd sdf tf plug arch vt trace)
 
 set(USD_DEPENDENCIES "Boost::boost;TBB::tbb")
 
@@ -93,6 +94,7 @@ find_package_handle_standard_args(
         plug_LIBRARY
         arch_LIBRARY
         vt_LIBRARY
+        trace_LIBRARY
     VERSION_VAR
         USD_VERSION
 )
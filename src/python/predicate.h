@@ -11,6 +11,9 @@
 #include <boost/python.hpp>
 
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 using namespace boost::python;
 using namespace unf;
@@ -20,18 +23,65 @@ PXR_NAMESPACE_USING_DIRECTIVE
 using _CapturePredicateFuncRaw = bool(object const&);
 using _CapturePredicateFunc = std::function<_CapturePredicateFuncRaw>;
 
-static CapturePredicateFunc WrapPredicate(_CapturePredicateFunc fn)
+static CapturePredicateFunc WrapPredicate(
+    _CapturePredicateFunc fn, bool perType = false)
 {
-    // Capture by-copy to prevent boost object from being destroyed.
+    // Hold function by shared pointer to prevent boost object from being
+    // destroyed, and to ensure that it is released with the GIL acquired as
+    // transactions can end while the GIL is released.
+    std::shared_ptr<_CapturePredicateFunc> function(
+        new _CapturePredicateFunc(std::move(fn)),
+        [](_CapturePredicateFunc* ptr) {
+            TfPyLock lock;
+            delete ptr;
+        });
+
+    if (!perType) {
+        return [=](const UnfNotice::StageNotice& notice) {
+            TfPyLock lock;
+
+            if (!*function) return true;
+
+            // Creates a Python version of the notice by inspecting its type
+            // and converting the generic StageNotice to the real notice
+            // inside.
+            object _notice = Tf_PyNoticeObjectGenerator::Invoke(notice);
+            return (*function)(_notice);
+        };
+    }
+
+    // Record decision per notice type so that the Python function is only
+    // called once per type, and the GIL is not acquired for other notices.
+    struct _Cache {
+        std::mutex mutex;
+        std::unordered_map<NoticeTypeKey, bool> decisions;
+    };
+
+    auto cache = std::make_shared<_Cache>();
+
     return [=](const UnfNotice::StageNotice& notice) {
-        TfPyLock lock;
+        const NoticeTypeKey key = notice.GetTypeKey();
+
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+
+            auto it = cache->decisions.find(key);
+            if (it != cache->decisions.end()) return it->second;
+        }
+
+        bool decision = true;
+
+        if (*function) {
+            TfPyLock lock;
+
+            object _notice = Tf_PyNoticeObjectGenerator::Invoke(notice);
+            decision = (*function)(_notice);
+        }
 
-        if (!fn) return true;
+        std::lock_guard<std::mutex> lock(cache->mutex);
+        cache->decisions.emplace(key, decision);
 
-        // Creates a Python version of the notice by inspecting its type and
-        // converting the generic StageNotice to the real notice inside.
-        object _notice = Tf_PyNoticeObjectGenerator::Invoke(notice);
-        return fn(_notice);
+        return decision;
     };
 }
 
@@ -7,7 +7,9 @@
 
 #include <pxr/base/tf/makePyConstructor.h>
 #include <pxr/base/tf/pyFunction.h>
+#include <pxr/base/tf/pyLock.h>
 #include <pxr/base/tf/pyPtrHelpers.h>
+#include <pxr/base/tf/pyUtils.h>
 #include <pxr/base/tf/weakPtr.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/common.h>
@@ -15,15 +17,123 @@
 
 #include <boost/python.hpp>
 
+#include <chrono>
+
 using namespace boost::python;
 using namespace unf;
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
-void Broker_BeginTransaction_WithFunc(Broker& self, object predicate)
+// Release the GIL while the broker is created, as brokers targeting expired
+// stages might be destroyed meanwhile, and Python listeners might be invoked
+// from their delivery threads.
+BrokerPtr Broker_Create(const UsdStageWeakPtr& stage)
+{
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+    return Broker::Create(stage);
+}
+
+void Broker_BeginTransaction_WithFunc(
+    Broker& self, object predicate, TransactionScope scope, bool perType)
+{
+    auto _predicate = WrapPredicate(predicate, perType);
+    self.BeginTransaction(_predicate, scope);
+}
+
+// Release the GIL while notices are merged, post-processed and sent, as
+// Python listeners acquire it when invoked. A reference to the broker is
+// held so that it cannot be destroyed from another Python thread meanwhile.
+void Broker_EndTransaction(const BrokerWeakPtr& self)
+{
+    BrokerPtr broker = TfCreateRefPtrFromProtectedWeakPtr(self);
+    if (!broker) {
+        TfPyThrowRuntimeError("Broker has expired.");
+    }
+
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+    broker->EndTransaction();
+}
+
+// Release the GIL while waiting for notices to be delivered, as Python
+// listeners invoked on the delivery thread need to acquire it.
+void Broker_SetAsyncDelivery(Broker& self, bool enabled)
+{
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+    self.SetAsyncDelivery(enabled);
+}
+
+void Broker_WaitForDelivery(Broker& self)
+{
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+    self.WaitForDelivery();
+}
+
+void Broker_EnableDebounce(Broker& self, int quietPeriod, int maxLatency)
+{
+    self.EnableDebounce(
+        std::chrono::milliseconds(quietPeriod),
+        std::chrono::milliseconds(maxLatency));
+}
+
+// Return list of counters recorded for each notice type.
+list BrokerStatistics_GetNotices(const BrokerStatistics& self)
+{
+    list notices;
+    for (const auto& notice : self.notices) {
+        notices.append(notice);
+    }
+    return notices;
+}
+
+// Return list of latencies recorded for each notice type and listener.
+list BrokerStatistics_GetLatencies(const BrokerStatistics& self)
+{
+    list latencies;
+    for (const auto& latency : self.latencies) {
+        latencies.append(latency);
+    }
+    return latencies;
+}
+
+// Return durations in seconds.
+double _GetSeconds(std::chrono::nanoseconds duration)
 {
-    auto _predicate = WrapPredicate(predicate);
-    self.BeginTransaction(_predicate);
+    return std::chrono::duration<double>(duration).count();
+}
+
+double LatencyStatistics_GetP50(const LatencyStatistics& self)
+{
+    return _GetSeconds(self.p50);
+}
+
+double LatencyStatistics_GetP99(const LatencyStatistics& self)
+{
+    return _GetSeconds(self.p99);
+}
+
+double LatencyStatistics_GetMax(const LatencyStatistics& self)
+{
+    return _GetSeconds(self.max);
+}
+
+double BrokerStatistics_GetCaptureTime(const BrokerStatistics& self)
+{
+    return _GetSeconds(self.captureTime);
+}
+
+double BrokerStatistics_GetMergeTime(const BrokerStatistics& self)
+{
+    return _GetSeconds(self.mergeTime);
+}
+
+double BrokerStatistics_GetPostProcessTime(const BrokerStatistics& self)
+{
+    return _GetSeconds(self.postProcessTime);
+}
+
+double BrokerStatistics_GetSendTime(const BrokerStatistics& self)
+{
+    return _GetSeconds(self.sendTime);
 }
 
 void wrapBroker()
@@ -31,6 +141,56 @@ void wrapBroker()
     // Ensure that predicate function can be passed from Python.
     TfPyFunctionFromPython<_CapturePredicateFuncRaw>();
 
+    enum_<TransactionScope>(
+        "TransactionScope",
+        "Indicate which threads a notice transaction captures notices from.")
+        .value("Thread", TransactionScope::Thread)
+        .value("Concurrent", TransactionScope::Concurrent);
+
+    enum_<JournalMode>(
+        "JournalMode", "Indicate which notices are recorded in a journal.")
+        .value("Emitted", JournalMode::Emitted)
+        .value("Captured", JournalMode::Captured);
+
+    class_<NoticeStatistics>(
+        "NoticeStatistics",
+        "Counters describing notices of one type processed by a broker.",
+        no_init)
+
+        .def_readonly("typeName", &NoticeStatistics::typeName)
+        .def_readonly("received", &NoticeStatistics::received)
+        .def_readonly("captured", &NoticeStatistics::captured)
+        .def_readonly("filtered", &NoticeStatistics::filtered)
+        .def_readonly("merged", &NoticeStatistics::merged)
+        .def_readonly("sent", &NoticeStatistics::sent);
+
+    class_<LatencyStatistics>(
+        "LatencyStatistics",
+        "Approximated distribution of the time spent delivering notices of "
+        "one type.",
+        no_init)
+
+        .def_readonly("typeName", &LatencyStatistics::typeName)
+        .def_readonly("listenerName", &LatencyStatistics::listenerName)
+        .def_readonly("count", &LatencyStatistics::count)
+        .add_property("p50", &LatencyStatistics_GetP50)
+        .add_property("p99", &LatencyStatistics_GetP99)
+        .add_property("max", &LatencyStatistics_GetMax);
+
+    class_<BrokerStatistics>(
+        "BrokerStatistics",
+        "Counters and cumulative times describing the work performed by a "
+        "broker.",
+        no_init)
+
+        .add_property("notices", &BrokerStatistics_GetNotices)
+        .add_property("captureTime", &BrokerStatistics_GetCaptureTime)
+        .add_property("mergeTime", &BrokerStatistics_GetMergeTime)
+        .add_property(
+            "postProcessTime", &BrokerStatistics_GetPostProcessTime)
+        .add_property("sendTime", &BrokerStatistics_GetSendTime)
+        .add_property("latencies", &BrokerStatistics_GetLatencies);
+
     class_<Broker, BrokerWeakPtr, boost::noncopyable>(
         "Broker",
         "Intermediate object between the Usd Stage and any clients that needs "
@@ -41,7 +201,7 @@ void wrapBroker()
 
         .def(
             "Create",
-            &Broker::Create,
+            &Broker_Create,
             arg("stage"),
             "Create a broker from a Usd Stage.",
             return_value_policy<TfPyRefPtrFactory<> >())
@@ -60,18 +220,149 @@ void wrapBroker()
 
         .def(
             "BeginTransaction",
-            (void(Broker::*)(CapturePredicate)) & Broker::BeginTransaction,
-            (arg("predicate") = CapturePredicate::Default()),
+            (void(Broker::*)(CapturePredicate, TransactionScope))
+                & Broker::BeginTransaction,
+            (arg("predicate") = CapturePredicate::Default(),
+             arg("scope") = TransactionScope::Thread),
             "Start a notice transaction.")
 
         .def(
             "BeginTransaction",
             &Broker_BeginTransaction_WithFunc,
-            ((arg("self"), arg("predicate"))),
+            ((arg("self"), arg("predicate"),
+              arg("scope") = TransactionScope::Thread,
+              arg("perType") = false)),
             "Start a notice transaction with a function predicate.")
 
         .def(
             "EndTransaction",
-            &Broker::EndTransaction,
-            "Stop a notice transaction.");
+            &Broker_EndTransaction,
+            "Stop a notice transaction.")
+
+        .def(
+            "GetMergeOnCapture",
+            &Broker::GetMergeOnCapture,
+            "Indicate whether notices are merged as soon as they are "
+            "captured.")
+
+        .def(
+            "SetMergeOnCapture",
+            &Broker::SetMergeOnCapture,
+            arg("enabled"),
+            "Set whether notices are merged as soon as they are captured.")
+
+        .def(
+            "GetAsyncDelivery",
+            &Broker::GetAsyncDelivery,
+            "Indicate whether notices are delivered on a background thread.")
+
+        .def(
+            "SetAsyncDelivery",
+            &Broker_SetAsyncDelivery,
+            (arg("self"), arg("enabled")),
+            "Set whether notices are delivered on a background thread.")
+
+        .def(
+            "WaitForDelivery",
+            &Broker_WaitForDelivery,
+            "Block until all notices queued for asynchronous delivery have "
+            "been delivered.")
+
+        .def(
+            "EnableDebounce",
+            &Broker_EnableDebounce,
+            (arg("self"), arg("quietPeriod"), arg("maxLatency")),
+            "Collect notices sent outside of transactions and deliver them "
+            "in consolidated batches.")
+
+        .def(
+            "DisableDebounce",
+            &Broker::DisableDebounce,
+            "Stop collecting notices sent outside of transactions.")
+
+        .def(
+            "IsDebounceEnabled",
+            &Broker::IsDebounceEnabled,
+            "Indicate whether notices sent outside of transactions are "
+            "collected.")
+
+        .def(
+            "Poll",
+            &Broker::Poll,
+            "Deliver pending notices collected outside of transactions if "
+            "the quiet period or the maximum latency has elapsed.")
+
+        .def(
+            "Flush",
+            &Broker::Flush,
+            "Deliver pending notices collected outside of transactions "
+            "immediately.")
+
+        .def(
+            "GetStatistics",
+            &Broker::GetStatistics,
+            "Return counters and cumulative times describing the notices "
+            "processed by the broker.")
+
+        .def(
+            "ResetStatistics",
+            &Broker::ResetStatistics,
+            "Reset all counters, cumulative times and latencies.")
+
+        .def(
+            "GetTimeTracking",
+            &Broker::GetTimeTracking,
+            "Indicate whether the time spent in each phase of the notice flow "
+            "is recorded.")
+
+        .def(
+            "SetTimeTracking",
+            &Broker::SetTimeTracking,
+            arg("enabled"),
+            "Set whether the time spent in each phase of the notice flow is "
+            "recorded.")
+
+        .def(
+            "GetLatencyTracking",
+            &Broker::GetLatencyTracking,
+            "Indicate whether delivery latencies are recorded.")
+
+        .def(
+            "SetLatencyTracking",
+            &Broker::SetLatencyTracking,
+            arg("enabled"),
+            "Set whether delivery latencies are recorded.")
+
+        .def(
+            "StartRecording",
+            &Broker::StartRecording,
+            arg("filePath"),
+            "Start recording the activity of the broker into a Chrome trace "
+            "file.")
+
+        .def(
+            "StopRecording",
+            &Broker::StopRecording,
+            "Stop recording the activity of the broker.")
+
+        .def(
+            "IsRecording",
+            &Broker::IsRecording,
+            "Indicate whether the activity of the broker is recorded.")
+
+        .def(
+            "StartJournal",
+            &Broker::StartJournal,
+            (arg("filePath"), arg("mode") = JournalMode::Emitted),
+            "Start recording notices into a journal file.")
+
+        .def(
+            "StopJournal",
+            &Broker::StopJournal,
+            "Stop recording notices into a journal file and close the file.")
+
+        .def(
+            "IsJournaling",
+            &Broker::IsJournaling,
+            "Indicate whether notices are recorded into a journal file.");
 }
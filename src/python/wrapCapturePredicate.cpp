@@ -1,14 +1,51 @@
 #include "./predicate.h"
 
 #include "unf/capturePredicate.h"
+#include "unf/notice.h"
+
+#include <pxr/base/tf/pyUtils.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/pxr.h>
 
 #include <boost/python.hpp>
+#include <boost/python/operators.hpp>
+#include <boost/python/stl_iterator.hpp>
+
+#include <vector>
 
 using namespace boost::python;
 using namespace unf;
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+// Return interned type keys of notice classes.
+std::vector<NoticeTypeKey> _GetTypeKeys(const object& types)
+{
+    std::vector<NoticeTypeKey> keys;
+
+    stl_input_iterator<object> it(types), end;
+    for (; it != end; ++it) {
+        TfType type = TfType::FindByPythonClass(*it);
+        if (type.IsUnknown()) {
+            TfPyThrowTypeError("Expecting a notice class.");
+        }
+
+        keys.push_back(
+            UnfNotice::StageNotice::InternTypeKey(type.GetTypeid()));
+    }
+
+    return keys;
+}
+
+CapturePredicate CapturePredicate_IncludeTypes(const object& types)
+{
+    return CapturePredicate::IncludeTypes(_GetTypeKeys(types));
+}
+
+CapturePredicate CapturePredicate_ExcludeTypes(const object& types)
+{
+    return CapturePredicate::ExcludeTypes(_GetTypeKeys(types));
+}
 
 void wrapCapturePredicate()
 {
@@ -28,5 +65,29 @@ void wrapCapturePredicate()
             "BlockAll",
             &CapturePredicate::BlockAll,
             "Create a predicate which return false for each notice type.")
-        .staticmethod("BlockAll");
+        .staticmethod("BlockAll")
+
+        .def(
+            "IncludeTypes",
+            &CapturePredicate_IncludeTypes,
+            arg("types"),
+            "Create a predicate which only return true for notice types "
+            "listed.")
+        .staticmethod("IncludeTypes")
+
+        .def(
+            "ExcludeTypes",
+            &CapturePredicate_ExcludeTypes,
+            arg("types"),
+            "Create a predicate which return false for notice types listed.")
+        .staticmethod("ExcludeTypes")
+
+        .def(
+            "IsTypeBased",
+            &CapturePredicate::IsTypeBased,
+            "Indicate whether the predicate only depends on notice types.")
+
+        .def(self & self)
+        .def(self | self)
+        .def(~self);
 }
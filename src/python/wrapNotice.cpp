@@ -46,29 +46,58 @@ void wrapNotice()
         .def(
             "GetTypeId",
             &StageNotice::GetTypeId,
-            "Return unique type identifier");
+            "Return unique type identifier")
+
+        .def(
+            "GetTypeKey",
+            &StageNotice::GetTypeKey,
+            "Return interned type key");
 
     TfPyNoticeWrapper<StageContentsChanged, StageNotice>::Wrap();
 
     TfPyNoticeWrapper<ObjectsChanged, StageNotice>::Wrap()
         .def(
             "AffectedObject",
-            &ObjectsChanged::AffectedObject,
+            (bool(ObjectsChanged::*)(const UsdObject&) const)
+                & ObjectsChanged::AffectedObject,
             "Indicate whether object was affected by the change that generated "
             "this notice.")
 
+        .def(
+            "AffectedObject",
+            (bool(ObjectsChanged::*)(const SdfPath&) const)
+                & ObjectsChanged::AffectedObject,
+            "Indicate whether path was affected by the change that generated "
+            "this notice.")
+
         .def(
             "ResyncedObject",
-            &ObjectsChanged::ResyncedObject,
+            (bool(ObjectsChanged::*)(const UsdObject&) const)
+                & ObjectsChanged::ResyncedObject,
             "Indicate whether object was resynced by the change that generated "
             "this notice.")
 
+        .def(
+            "ResyncedObject",
+            (bool(ObjectsChanged::*)(const SdfPath&) const)
+                & ObjectsChanged::ResyncedObject,
+            "Indicate whether path was resynced by the change that generated "
+            "this notice.")
+
         .def(
             "ChangedInfoOnly",
-            &ObjectsChanged::ChangedInfoOnly,
+            (bool(ObjectsChanged::*)(const UsdObject&) const)
+                & ObjectsChanged::ChangedInfoOnly,
             "Indicate whether object was modified but not resynced by the "
             "change that generated this notice.")
 
+        .def(
+            "ChangedInfoOnly",
+            (bool(ObjectsChanged::*)(const SdfPath&) const)
+                & ObjectsChanged::ChangedInfoOnly,
+            "Indicate whether path was modified but not resynced by the "
+            "change that generated this notice.")
+
         .def(
             "GetResyncedPaths",
             &ObjectsChanged::GetResyncedPaths,
@@ -5,6 +5,7 @@
 #include "unf/transaction.h"
 
 #include <pxr/base/tf/pyFunction.h>
+#include <pxr/base/tf/pyLock.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/common.h>
 #include <pxr/usd/usd/stage.h>
@@ -20,38 +21,50 @@ PXR_NAMESPACE_USING_DIRECTIVE
 // Expose C++ RAII class as python context manager.
 struct PythonNoticeTransaction {
     PythonNoticeTransaction(
-        const BrokerWeakPtr& broker, const _CapturePredicateFunc& func)
+        const BrokerWeakPtr& broker,
+        const _CapturePredicateFunc& func,
+        TransactionScope scope,
+        bool perType)
         : _func(func)
     {
         _makeContext = [=]() {
-            return new NoticeTransaction(broker, WrapPredicate(_func));
+            return new NoticeTransaction(
+                broker, WrapPredicate(_func, perType), scope);
         };
     }
 
     PythonNoticeTransaction(
-        const BrokerWeakPtr& broker, CapturePredicate predicate)
+        const BrokerWeakPtr& broker,
+        CapturePredicate predicate,
+        TransactionScope scope)
         : _predicate(predicate)
     {
         _makeContext = [=]() {
-            return new NoticeTransaction(broker, _predicate);
+            return new NoticeTransaction(broker, _predicate, scope);
         };
     }
 
     PythonNoticeTransaction(
-        const UsdStageWeakPtr& stage, const _CapturePredicateFunc& func)
+        const UsdStageWeakPtr& stage,
+        const _CapturePredicateFunc& func,
+        TransactionScope scope,
+        bool perType)
         : _func(func)
     {
         _makeContext = [=]() {
-            return new NoticeTransaction(stage, WrapPredicate(_func));
+            return new NoticeTransaction(
+                stage, WrapPredicate(_func, perType), scope);
         };
     }
 
     PythonNoticeTransaction(
-        const UsdStageWeakPtr& stage, CapturePredicate predicate)
+        const UsdStageWeakPtr& stage,
+        CapturePredicate predicate,
+        TransactionScope scope)
         : _predicate(predicate)
     {
         _makeContext = [=]() {
-            return new NoticeTransaction(stage, _predicate);
+            return new NoticeTransaction(stage, _predicate, scope);
         };
     }
 
@@ -62,8 +75,14 @@ struct PythonNoticeTransaction {
         return this;
     }
 
-    // Drop the shared_ptr.
-    void __exit__(object, object, object) { _context.reset(); }
+    // Drop the shared_ptr, which ends the transaction. The GIL is released
+    // while notices are merged, post-processed and sent, as Python
+    // listeners acquire it when invoked.
+    void __exit__(object, object, object)
+    {
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        _context.reset();
+    }
 
     BrokerPtr GetBroker() { return _context->GetBroker(); }
 
@@ -86,21 +105,39 @@ void wrapTransaction()
         "from UnfNotice.StageNotice within a specific scope",
         no_init)
 
-        .def(init<const BrokerWeakPtr&, CapturePredicate>(
-            (arg("broker"), arg("predicate") = CapturePredicate::Default()),
+        .def(init<const BrokerWeakPtr&, CapturePredicate, TransactionScope>(
+            (arg("broker"),
+             arg("predicate") = CapturePredicate::Default(),
+             arg("scope") = TransactionScope::Thread),
             "Create transaction from a Broker."))
 
-        .def(init<const BrokerWeakPtr&, const _CapturePredicateFunc&>(
-            (arg("broker"), arg("predicate")),
+        .def(init<
+                const BrokerWeakPtr&,
+                const _CapturePredicateFunc&,
+                TransactionScope,
+                bool>(
+            (arg("broker"),
+             arg("predicate"),
+             arg("scope") = TransactionScope::Thread,
+             arg("perType") = false),
             "Create transaction from a Broker with a capture predicate "
             "function."))
 
-        .def(init<const UsdStageWeakPtr&, CapturePredicate>(
-            (arg("stage"), arg("predicate") = CapturePredicate::Default()),
+        .def(init<const UsdStageWeakPtr&, CapturePredicate, TransactionScope>(
+            (arg("stage"),
+             arg("predicate") = CapturePredicate::Default(),
+             arg("scope") = TransactionScope::Thread),
             "Create transaction from a UsdStage."))
 
-        .def(init<const UsdStageWeakPtr&, const _CapturePredicateFunc&>(
-            (arg("stage"), arg("predicate")),
+        .def(init<
+                const UsdStageWeakPtr&,
+                const _CapturePredicateFunc&,
+                TransactionScope,
+                bool>(
+            (arg("stage"),
+             arg("predicate"),
+             arg("scope") = TransactionScope::Thread,
+             arg("perType") = false),
             "Create transaction from a UsdStage with a capture predicate "
             "function."))
 
@@ -1,23 +1,597 @@
 #include "unf/broker.h"
 #include "unf/capturePredicate.h"
+#include "unf/debouncer.h"
+#include "unf/deliveryQueue.h"
 #include "unf/dispatcher.h"
+#include "unf/journal.h"
+#include "unf/latencyProbe.h"
 #include "unf/notice.h"
+#include "unf/recorder.h"
 
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/weakPtr.h>
+#include <pxr/base/trace/collector.h>
+#include <pxr/base/trace/trace.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/common.h>
 #include <pxr/usd/usd/notice.h>
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_vector.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace unf {
 
-// Initiate static registry.
-std::unordered_map<UsdStageWeakPtr, BrokerPtr, Broker::UsdStageWeakPtrHasher>
-    Broker::Registry;
+namespace {
+
+struct UsdStageWeakPtrHasher {
+    std::size_t operator()(const UsdStageWeakPtr& ptr) const
+    {
+        return hash_value(ptr);
+    }
+};
+
+// Record each hashed stage pointer to its corresponding broker pointer.
+//
+// Brokers are distributed into shards guarded by their own lock, so that
+// brokers targeting distinct stages can be created concurrently and lookups
+// only need to acquire a shared lock. Brokers are neither created nor
+// released while holding a lock, as their construction loads dispatchers
+// from plugins which could create brokers themselves, and their destruction
+// revokes listeners.
+//
+// Brokers targeting expired stages are evicted by an amortized sweep: each
+// registration is recorded in a queue with a unique generation, and every new
+// registration inspects a bounded number of live entries from the front of
+// the queue, so that creating a broker is constant time on average.
+class BrokerRegistry {
+  public:
+    static BrokerRegistry& GetInstance()
+    {
+        static BrokerRegistry registry;
+        return registry;
+    }
+
+    // Brokers remaining in the registry are destroyed at process exit.
+    ~BrokerRegistry() { _GetFinalizing().store(true); }
+
+    // Indicate whether the registry is being destroyed at process exit.
+    static bool IsFinalizing() { return _GetFinalizing().load(); }
+
+    // Return broker associated with stage if it exists, or a null pointer.
+    // Wait for the broker if it is being created by another thread.
+    BrokerPtr Find(const UsdStageWeakPtr& stage)
+    {
+        _Future broker;
+
+        _Shard& shard = _GetShard(stage);
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+            auto it = shard.entries.find(stage);
+            if (it == shard.entries.end()) {
+                return BrokerPtr();
+            }
+
+            broker = it->second.broker;
+        }
+
+        return broker.get();
+    }
+
+    // Return broker associated with stage, or register the broker returned
+    // by the factory if none has been registered yet.
+    //
+    // A placeholder is registered before calling the factory outside of the
+    // lock, so that a single broker is ever created per stage. Other threads
+    // requesting the same stage wait for the broker to be created.
+    template <class Factory>
+    BrokerPtr FindOrCreate(const UsdStageWeakPtr& stage, Factory factory)
+    {
+        std::promise<BrokerPtr> promise;
+        size_t generation = 0;
+
+        _Shard& shard = _GetShard(stage);
+        {
+            _Future existing;
+            {
+                std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+                auto it = shard.entries.find(stage);
+                if (it != shard.entries.end()) {
+                    existing = it->second.broker;
+                }
+                else {
+                    generation =
+                        _generation.fetch_add(1, std::memory_order_relaxed);
+
+                    shard.entries.emplace(
+                        stage,
+                        _Entry{promise.get_future().share(), generation});
+                }
+            }
+
+            if (existing.valid()) {
+                return existing.get();
+            }
+        }
+
+        BrokerPtr broker;
+        try {
+            broker = factory();
+        }
+        catch (...) {
+            promise.set_exception(std::current_exception());
+            _Remove(stage, generation);
+            throw;
+        }
+
+        promise.set_value(broker);
+
+        _Sweep(stage, generation);
+
+        return broker;
+    }
+
+    // Remove broker associated with stage.
+    void Remove(const UsdStageWeakPtr& stage)
+    {
+        _Future broker;
+
+        _Shard& shard = _GetShard(stage);
+        {
+            std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+            auto it = shard.entries.find(stage);
+            if (it == shard.entries.end()) {
+                return;
+            }
+
+            broker = std::move(it->second.broker);
+            shard.entries.erase(it);
+        }
+    }
+
+    // Remove all brokers.
+    void Clear()
+    {
+        // Entries are declared before the lock so that brokers are released
+        // once the sweep lock is released.
+        std::vector<_EntryMap> cleared(_shardCount);
+
+        std::lock_guard<std::mutex> sweepLock(_sweepMutex);
+        _sweepQueue.clear();
+
+        for (size_t i = 0; i < _shardCount; ++i) {
+            std::unique_lock<std::shared_timed_mutex> lock(_shards[i].mutex);
+            cleared[i].swap(_shards[i].entries);
+        }
+    }
+
+  private:
+    // Broker which might still be created by another thread.
+    using _Future = std::shared_future<BrokerPtr>;
+
+    struct _Entry {
+        _Future broker;
+        size_t generation;
+    };
+
+    using _EntryMap =
+        std::unordered_map<UsdStageWeakPtr, _Entry, UsdStageWeakPtrHasher>;
+
+    struct _Shard {
+        std::shared_timed_mutex mutex;
+        _EntryMap entries;
+    };
+
+    using _SweepEntry = std::pair<UsdStageWeakPtr, size_t>;
+
+    static std::atomic<bool>& _GetFinalizing()
+    {
+        static std::atomic<bool> finalizing{false};
+        return finalizing;
+    }
+
+    static constexpr size_t _shardCount = 64;
+
+    // Remove placeholder registered for stage with generation.
+    void _Remove(const UsdStageWeakPtr& stage, size_t generation)
+    {
+        _Future broker;
+
+        _Shard& shard = _GetShard(stage);
+        {
+            std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+            auto it = shard.entries.find(stage);
+            if (it != shard.entries.end()
+                && it->second.generation == generation) {
+                broker = std::move(it->second.broker);
+                shard.entries.erase(it);
+            }
+        }
+    }
+
+    // Number of live entries inspected per registration. A value greater
+    // than one ensures that the queue cannot grow faster than it is swept.
+    static constexpr size_t _sweepCount = 2;
+
+    _Shard& _GetShard(const UsdStageWeakPtr& stage)
+    {
+        // Mix the hash as weak pointer hashes are derived from addresses
+        // with low bits that are mostly identical.
+        size_t hash = UsdStageWeakPtrHasher()(stage);
+        hash ^= hash >> 17;
+        hash *= 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+
+        return _shards[hash % _shardCount];
+    }
+
+    // Evict brokers targeting expired stages from the front of the queue
+    // and record the new registration at the back.
+    //
+    // Entries which are expired or which do not match the registered
+    // generation anymore (e.g. after a reset) are dropped without being
+    // counted, as each entry can only be dropped once. Live entries are
+    // rotated to the back of the queue.
+    void _Sweep(const UsdStageWeakPtr& stage, size_t generation)
+    {
+        std::vector<_Future> expired;
+
+        std::lock_guard<std::mutex> sweepLock(_sweepMutex);
+
+        size_t inspected = 0;
+        while (!_sweepQueue.empty() && inspected < _sweepCount) {
+            _SweepEntry entry = std::move(_sweepQueue.front());
+            _sweepQueue.pop_front();
+
+            _Shard& shard = _GetShard(entry.first);
+
+            if (entry.first.IsExpired()) {
+                std::unique_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+                auto it = shard.entries.find(entry.first);
+                if (it != shard.entries.end()
+                    && it->second.generation == entry.second) {
+                    expired.push_back(std::move(it->second.broker));
+                    shard.entries.erase(it);
+                }
+
+                continue;
+            }
+
+            std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+
+            auto it = shard.entries.find(entry.first);
+            if (it != shard.entries.end()
+                && it->second.generation == entry.second) {
+                _sweepQueue.push_back(std::move(entry));
+                inspected++;
+            }
+        }
+
+        _sweepQueue.emplace_back(stage, generation);
+    }
+
+    std::array<_Shard, _shardCount> _shards;
+    std::atomic<size_t> _generation{0};
+
+    std::mutex _sweepMutex;
+    std::deque<_SweepEntry> _sweepQueue;
+};
+
+}  // namespace
+
+// Record counters per notice type and cumulative time spent in each phase
+// of the notice flow.
+//
+// Values are recorded in storage local to each thread, which is only written
+// by its thread, so that capturing notices from several threads does not
+// contend on shared cache lines. Values are atomic so that they can be read
+// from any thread when statistics are queried, but they are updated without
+// read-modify-write operations. Resetting statistics records the current
+// values as a baseline instead of modifying the storage of other threads.
+//
+// Times are only measured when enabled, as reading the clock twice per
+// notice is significantly more expensive than updating counters.
+class Broker::_Statistics {
+  public:
+    enum Counter { Received, Captured, Filtered, Merged, Sent, CounterCount };
+    enum Phase { Capture, Merge, PostProcess, Send, PhaseCount };
+
+    // Add time elapsed within its scope to the cumulative time of a phase
+    // if times are measured.
+    class Timer {
+      public:
+        Timer(_Statistics& statistics, Phase phase)
+            : _statistics(statistics.IsTimed() ? &statistics : nullptr)
+            , _phase(phase)
+        {
+            if (_statistics) {
+                _start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Timer()
+        {
+            if (_statistics) {
+                _statistics->AddTime(
+                    _phase, std::chrono::steady_clock::now() - _start);
+            }
+        }
+
+      private:
+        _Statistics* _statistics;
+        Phase _phase;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    bool IsTimed() const { return _timed.load(std::memory_order_relaxed); }
+
+    void SetTimed(bool enabled)
+    {
+        _timed.store(enabled, std::memory_order_relaxed);
+    }
+
+    void Add(NoticeTypeKey key, Counter counter, uint64_t value = 1)
+    {
+        if (value == 0) {
+            return;
+        }
+
+        _Increment(_GetLocal().GetCounters(key).values[counter], value);
+    }
+
+    void AddTime(Phase phase, std::chrono::nanoseconds duration)
+    {
+        _Increment(_GetLocal().times[phase], duration.count());
+    }
+
+    BrokerStatistics Get() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const _Values values = _Sum();
+
+        BrokerStatistics statistics;
+
+        for (size_t key = 0; key < values.counters.size(); ++key) {
+            NoticeStatistics notice;
+            notice.received = _Difference(values, key, Received);
+            notice.captured = _Difference(values, key, Captured);
+            notice.filtered = _Difference(values, key, Filtered);
+            notice.merged = _Difference(values, key, Merged);
+            notice.sent = _Difference(values, key, Sent);
+
+            // Skip types which have not been processed since the last reset.
+            if (notice.received == 0 && notice.captured == 0
+                && notice.filtered == 0 && notice.merged == 0
+                && notice.sent == 0) {
+                continue;
+            }
+
+            notice.typeName = UnfNotice::StageNotice::GetTypeKeyName(key);
+            statistics.notices.push_back(std::move(notice));
+        }
+
+        statistics.captureTime = _DifferenceTime(values, Capture);
+        statistics.mergeTime = _DifferenceTime(values, Merge);
+        statistics.postProcessTime = _DifferenceTime(values, PostProcess);
+        statistics.sendTime = _DifferenceTime(values, Send);
+
+        return statistics;
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _baseline = _Sum();
+    }
+
+  private:
+    struct _Counters {
+        _Counters()
+        {
+            for (auto& value : values) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        std::array<std::atomic<uint64_t>, CounterCount> values;
+    };
+
+    // Storage written by a single thread.
+    struct _Local {
+        _Local()
+        {
+            for (auto& time : times) {
+                time.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        _Counters& GetCounters(NoticeTypeKey key)
+        {
+            // Counters are only published once they have been constructed.
+            // The concurrent vector does not relocate its elements when it
+            // grows, so that published counters can be read meanwhile.
+            if (key >= size.load(std::memory_order_relaxed)) {
+                counters.grow_to_at_least(key + 1);
+                size.store(key + 1, std::memory_order_release);
+            }
+
+            return counters[key];
+        }
+
+        tbb::concurrent_vector<_Counters> counters;
+        std::atomic<size_t> size{0};
+        std::array<std::atomic<int64_t>, PhaseCount> times;
+    };
+
+    // Values summed over all threads.
+    struct _Values {
+        std::vector<std::array<uint64_t, CounterCount> > counters;
+        std::array<int64_t, PhaseCount> times{};
+    };
+
+    template <class T>
+    static void _Increment(std::atomic<T>& value, T increment)
+    {
+        value.store(
+            value.load(std::memory_order_relaxed) + increment,
+            std::memory_order_relaxed);
+    }
+
+    _Local& _GetLocal()
+    {
+        bool exists;
+        _Local& local = _locals.local(exists);
+
+        // Storage of each thread is registered so that it can be read while
+        // other threads create their own storage.
+        if (!exists) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _registered.push_back(&local);
+        }
+
+        return local;
+    }
+
+    _Values _Sum() const
+    {
+        _Values values;
+
+        for (const _Local* local : _registered) {
+            const size_t size = local->size.load(std::memory_order_acquire);
+            if (values.counters.size() < size) {
+                values.counters.resize(size);
+            }
+
+            for (size_t key = 0; key < size; ++key) {
+                for (size_t counter = 0; counter < CounterCount; ++counter) {
+                    values.counters[key][counter] +=
+                        local->counters[key].values[counter].load(
+                            std::memory_order_relaxed);
+                }
+            }
+
+            for (size_t phase = 0; phase < PhaseCount; ++phase) {
+                values.times[phase] +=
+                    local->times[phase].load(std::memory_order_relaxed);
+            }
+        }
+
+        return values;
+    }
+
+    uint64_t _Difference(
+        const _Values& values, NoticeTypeKey key, Counter counter) const
+    {
+        uint64_t baseline = 0;
+        if (key < _baseline.counters.size()) {
+            baseline = _baseline.counters[key][counter];
+        }
+
+        return values.counters[key][counter] - baseline;
+    }
+
+    std::chrono::nanoseconds _DifferenceTime(
+        const _Values& values, Phase phase) const
+    {
+        return std::chrono::nanoseconds(
+            values.times[phase] - _baseline.times[phase]);
+    }
+
+    tbb::enumerable_thread_specific<_Local> _locals;
+    std::atomic<bool> _timed{false};
+
+    mutable std::mutex _mutex;
+    std::vector<_Local*> _registered;
+    _Values _baseline;
+};
+
+namespace {
+
+// Number of notices from which lists of distinct types are merged and
+// post-processed concurrently.
+constexpr size_t ParallelMergeThreshold = 512;
+
+// Number of notices from which a list of notices with associative merges is
+// reduced in parallel.
+constexpr size_t ParallelReduceThreshold = 1024;
+
+// Number of consecutive notices merged sequentially by each reduction task.
+constexpr size_t ParallelReduceGrainSize = 256;
+
+// Indicate whether each notice is only recorded once in notices, as a notice
+// sent several times could otherwise be merged concurrently by distinct tasks.
+//
+// Addresses are sorted in parallel so that large lists are checked with a
+// single allocation before being reduced.
+bool IsDistinct(const std::vector<UnfNotice::StageNoticeRefPtr>& notices)
+{
+    std::vector<const UnfNotice::StageNotice*> addresses(notices.size());
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, notices.size()),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t index = range.begin(); index < range.end(); ++index) {
+                addresses[index] = &*notices[index];
+            }
+        });
+
+    tbb::parallel_sort(addresses.begin(), addresses.end());
 
-Broker::Broker(const UsdStageWeakPtr& stage) : _stage(stage)
+    return std::adjacent_find(addresses.begin(), addresses.end())
+           == addresses.end();
+}
+
+// Return arguments describing a notice for recorded events.
+std::string GetRecordArgs(const UnfNotice::StageNotice& notice)
+{
+    size_t paths = 0;
+
+    auto objectsChanged =
+        dynamic_cast<const UnfNotice::ObjectsChanged*>(&notice);
+    if (objectsChanged) {
+        paths = objectsChanged->GetResyncedPaths().size()
+                + objectsChanged->GetChangedInfoOnlyPaths().size();
+    }
+
+    return "\"paths\": " + std::to_string(paths);
+}
+
+}  // namespace
+
+Broker::Broker(const UsdStageWeakPtr& stage)
+    : _stage(stage), _statistics(new _Statistics)
 {
+    // Record activity if requested via the environment.
+    _SetRecorder(_Recorder::GetFromEnvironment());
+
     // Add default dispatcher.
     _AddDispatcher<StageDispatcher>();
 
@@ -31,59 +605,458 @@ Broker::Broker(const UsdStageWeakPtr& stage) : _stage(stage)
     }
 }
 
+Broker::~Broker()
+{
+    // Listeners cannot be invoked safely anymore once the stage has expired
+    // or while the process exits, so pending notices are dropped instead of
+    // being delivered. Notices collected outside of transactions are never
+    // delivered from the destructor.
+    if (_deliveryQueue
+        && (_stage.IsExpired() || BrokerRegistry::IsFinalizing())) {
+        _deliveryQueue->Discard();
+    }
+}
+
 BrokerPtr Broker::Create(const UsdStageWeakPtr& stage)
 {
-    Broker::_CleanCache();
+    auto& registry = BrokerRegistry::GetInstance();
 
-    // If there doesn't exist a broker for the given stage, create a new broker.
-    if (Registry.find(stage) == Registry.end()) {
-        Registry[stage] = TfCreateRefPtr(new Broker(stage));
+    // Return existing broker while only sharing access to the registry.
+    BrokerPtr broker = registry.Find(stage);
+    if (broker) {
+        return broker;
     }
 
-    return Registry[stage];
+    // If there doesn't exist a broker for the given stage, create a new broker.
+    return registry.FindOrCreate(
+        stage, [&]() { return TfCreateRefPtr(new Broker(stage)); });
 }
 
-bool Broker::IsInTransaction() { return _mergers.size() > 0; }
+bool Broker::IsInTransaction()
+{
+    return _mergers.local().size() > 0
+           || _activeCapture.load(std::memory_order_acquire) != nullptr;
+}
 
-void Broker::BeginTransaction(CapturePredicate predicate)
+void Broker::BeginTransaction(
+    CapturePredicate predicate, TransactionScope scope)
 {
-    _mergers.push_back(_NoticeMerger(predicate));
+    auto& mergers = _mergers.local();
+
+    if (scope == TransactionScope::Concurrent) {
+        _BeginCapture(predicate, mergers.size());
+    }
+
+    mergers.push_back(_NoticeMerger(predicate, _mergeOnCapture));
+
+    if (_journal && _journalMode == JournalMode::Captured) {
+        _journal->AddBeginTransaction();
+    }
+
+    if (_recorder) {
+        _recorder->Begin(_recorderProcess, "Transaction", "transaction");
+    }
 }
 
-void Broker::BeginTransaction(const CapturePredicateFunc& function)
+void Broker::BeginTransaction(
+    const CapturePredicateFunc& function, TransactionScope scope)
 {
-    _mergers.push_back(_NoticeMerger(CapturePredicate(function)));
+    BeginTransaction(CapturePredicate(function), scope);
 }
 
 void Broker::EndTransaction()
 {
-    if (!IsInTransaction()) {
+    TRACE_FUNCTION();
+
+    auto& mergers = _mergers.local();
+
+    if (mergers.size() == 0) {
         return;
     }
 
-    _NoticeMerger& merger = _mergers.back();
+    if (_journal && _journalMode == JournalMode::Captured) {
+        _journal->AddEndTransaction();
+    }
+
+    _NoticeMerger& merger = mergers.back();
+
+    // Gather notices captured from other threads if the transaction
+    // started a concurrent capture.
+    _EndCapture(merger, mergers.size() - 1);
 
-    // If there are only one merger left, process all notices.
-    if (_mergers.size() == 1) {
-        merger.Merge();
-        merger.PostProcess();
-        merger.Send(_stage);
+    // If there are only one merger left, process all notices. Notices
+    // collected outside of transactions are delivered first to preserve
+    // ordering.
+    if (mergers.size() == 1) {
+        Flush();
+        _Process(merger);
     }
     // Otherwise, it means that we are in a nested transaction that should
     // not be processed yet. Join data with next merger.
     else {
-        (_mergers.end() - 2)->Join(merger);
+        (mergers.end() - 2)->Join(merger);
     }
 
-    _mergers.pop_back();
+    mergers.pop_back();
+
+    if (_recorder) {
+        _recorder->End(_recorderProcess, "Transaction", "transaction");
+    }
 }
 
 void Broker::Send(const UnfNotice::StageNoticeRefPtr& notice)
 {
-    if (_mergers.size() > 0) {
-        _mergers.back().Add(notice);
+    const NoticeTypeKey key = notice->GetTypeKey();
+    _statistics->Add(key, _Statistics::Received);
+
+    if (_journal && _journalMode == JournalMode::Captured) {
+        _journal->AddNotice(*notice);
+    }
+
+    auto& mergers = _mergers.local();
+
+    if (mergers.size() > 0) {
+        _Capture(mergers.back(), notice, key);
+        return;
+    }
+
+    // If a concurrent transaction is opened, capture notice in the buffer
+    // of the calling thread. Buffers are guarded by the calling thread while
+    // in use so that the transaction cannot detach them meanwhile.
+    if (_activeCapture.load(std::memory_order_acquire)) {
+        _CaptureGuard& guard = _GetCaptureGuard();
+
+        _ConcurrentCapture* capture = _activeCapture.load();
+        guard.capture.store(capture);
+
+        // Buffers are only used if they have not been detached before being
+        // guarded.
+        const bool guarded = capture && capture == _activeCapture.load();
+        if (guarded) {
+            _Capture(capture->buffers.local(), notice, key);
+        }
+
+        guard.capture.store(nullptr, std::memory_order_release);
+
+        if (guarded) {
+            return;
+        }
+    }
+
+    // If debouncing, collect notice in implicit transaction.
+    if (_debouncer) {
+        _NoticeMerger merger = _Debouncer::CreateMerger();
+
+        bool flush;
+        {
+            _Statistics::Timer timer(*_statistics, _Statistics::Capture);
+            flush = _debouncer->Add(notice, key, merger);
+        }
+        _statistics->Add(key, _Statistics::Captured);
+
+        if (_recorder) {
+            _RecordCapture(*notice, key, true);
+        }
+
+        if (flush) {
+            _Process(merger);
+        }
+        return;
     }
+
     // Otherwise, send the notice.
+    {
+        _Statistics::Timer timer(*_statistics, _Statistics::Send);
+        _Emit(notice, key);
+    }
+    _statistics->Add(key, _Statistics::Sent);
+
+    if (_HasBatchListeners()) {
+        _SendBatch({notice});
+    }
+}
+
+BatchListenerKey Broker::AddBatchListener(const BatchListenerFunc& function)
+{
+    std::lock_guard<std::mutex> lock(_batchListenerMutex);
+
+    const BatchListenerKey key = ++_batchListenerKey;
+    _batchListeners.emplace_back(key, function);
+    _batchListenerCount.store(
+        _batchListeners.size(), std::memory_order_release);
+
+    return key;
+}
+
+void Broker::RemoveBatchListener(BatchListenerKey key)
+{
+    std::lock_guard<std::mutex> lock(_batchListenerMutex);
+
+    auto it = std::find_if(
+        _batchListeners.begin(),
+        _batchListeners.end(),
+        [&](const std::pair<BatchListenerKey, BatchListenerFunc>& element) {
+            return element.first == key;
+        });
+
+    if (it != _batchListeners.end()) {
+        _batchListeners.erase(it);
+        _batchListenerCount.store(
+            _batchListeners.size(), std::memory_order_release);
+    }
+}
+
+bool Broker::GetAsyncDelivery() const { return _deliveryQueue != nullptr; }
+
+void Broker::SetAsyncDelivery(bool enabled)
+{
+    if (enabled && !_deliveryQueue) {
+        _deliveryQueue.reset(new _DeliveryQueue(_stage));
+    }
+    // Pending notices are delivered when the queue is destroyed.
+    else if (!enabled) {
+        _deliveryQueue.reset();
+    }
+}
+
+void Broker::WaitForDelivery()
+{
+    if (_deliveryQueue) {
+        _deliveryQueue->Wait();
+    }
+}
+
+void Broker::EnableDebounce(
+    std::chrono::milliseconds quietPeriod,
+    std::chrono::milliseconds maxLatency,
+    const ClockFunc& clock)
+{
+    Flush();
+    _debouncer.reset(new _Debouncer(quietPeriod, maxLatency, clock));
+}
+
+void Broker::DisableDebounce()
+{
+    Flush();
+    _debouncer.reset();
+}
+
+bool Broker::IsDebounceEnabled() const { return _debouncer != nullptr; }
+
+bool Broker::Poll()
+{
+    if (!_debouncer) {
+        return false;
+    }
+
+    _NoticeMerger merger = _Debouncer::CreateMerger();
+    if (!_debouncer->Poll(merger)) {
+        return false;
+    }
+
+    _Process(merger);
+    return true;
+}
+
+void Broker::Flush()
+{
+    if (!_debouncer) {
+        return;
+    }
+
+    _NoticeMerger merger = _Debouncer::CreateMerger();
+    if (_debouncer->Take(merger)) {
+        _Process(merger);
+    }
+}
+
+BrokerStatistics Broker::GetStatistics() const
+{
+    BrokerStatistics statistics = _statistics->Get();
+
+    if (_latencyProbe) {
+        _latencyProbe->Fill(statistics);
+    }
+
+    return statistics;
+}
+
+bool Broker::GetTimeTracking() const
+{
+    return _statistics->IsTimed();
+}
+
+void Broker::SetTimeTracking(bool enabled)
+{
+    _statistics->SetTimed(enabled);
+}
+
+void Broker::ResetStatistics()
+{
+    _statistics->Reset();
+
+    if (_latencyProbe) {
+        _latencyProbe->Reset();
+    }
+}
+
+bool Broker::GetLatencyTracking() const
+{
+    return _latencyProbe && _latencyProbe->IsEnabled();
+}
+
+void Broker::SetLatencyTracking(bool enabled)
+{
+    // Probe is kept once created so that latencies can be queried after
+    // the mode is disabled.
+    if (enabled && !_latencyProbe) {
+        _latencyProbe.reset(new _LatencyProbe(_stage));
+    }
+
+    if (enabled) {
+        _latencyProbe->Enable();
+    }
+    else if (_latencyProbe) {
+        _latencyProbe->Disable();
+    }
+}
+
+bool Broker::IsRecording() const { return _recorder != nullptr; }
+
+void Broker::StartRecording(const std::string& filePath)
+{
+    auto recorder = std::make_shared<_Recorder>(filePath);
+    if (!recorder->IsValid()) {
+        recorder.reset();
+    }
+
+    _SetRecorder(recorder);
+}
+
+void Broker::StopRecording()
+{
+    // The file is completed once no other brokers use the recorder.
+    _SetRecorder(nullptr);
+}
+
+bool Broker::IsJournaling() const { return _journal != nullptr; }
+
+void Broker::StartJournal(const std::string& filePath, JournalMode mode)
+{
+    // Close previous journal first in case the same file is used.
+    _journal.reset();
+
+    _journal.reset(new JournalWriter(filePath));
+    _journalMode = mode;
+
+    if (!_journal->IsValid()) {
+        _journal.reset();
+    }
+}
+
+void Broker::StopJournal() { _journal.reset(); }
+
+void Broker::_SetRecorder(const std::shared_ptr<_Recorder>& recorder)
+{
+    _recorder = recorder;
+
+    if (_recorder) {
+        _recorderProcess = _recorder->AddProcess("Broker");
+    }
+}
+
+void Broker::_RecordCapture(
+    const UnfNotice::StageNotice& notice, NoticeTypeKey key, bool captured)
+{
+    _recorder->Instant(
+        _recorderProcess,
+        UnfNotice::StageNotice::GetTypeKeyName(key),
+        captured ? "capture" : "filter",
+        GetRecordArgs(notice));
+}
+
+void Broker::_Process(_NoticeMerger& merger)
+{
+    {
+        _Statistics::Timer timer(*_statistics, _Statistics::Merge);
+        merger.Merge(*this);
+    }
+    {
+        _Statistics::Timer timer(*_statistics, _Statistics::PostProcess);
+        merger.PostProcess(*this);
+    }
+    {
+        _Statistics::Timer timer(*_statistics, _Statistics::Send);
+        merger.Send(*this);
+    }
+}
+
+void Broker::_SendBatch(
+    const std::vector<UnfNotice::StageNoticeRefPtr>& notices)
+{
+    TRACE_FUNCTION();
+
+    // Invoke copies of the functions outside of the lock so that listeners
+    // can be added or removed from a function.
+    std::vector<std::pair<BatchListenerKey, BatchListenerFunc> > listeners;
+    {
+        std::lock_guard<std::mutex> lock(_batchListenerMutex);
+        listeners = _batchListeners;
+    }
+
+    for (const auto& listener : listeners) {
+        listener.second(notices);
+    }
+}
+
+void Broker::_Capture(
+    _NoticeMerger& merger,
+    const UnfNotice::StageNoticeRefPtr& notice,
+    NoticeTypeKey key)
+{
+    bool captured;
+    {
+        _Statistics::Timer timer(*_statistics, _Statistics::Capture);
+        captured = merger.Add(notice, key);
+    }
+
+    _statistics->Add(
+        key, captured ? _Statistics::Captured : _Statistics::Filtered);
+
+    if (_recorder) {
+        _RecordCapture(*notice, key, captured);
+    }
+}
+
+void Broker::_Emit(
+    const UnfNotice::StageNoticeRefPtr& notice, NoticeTypeKey key)
+{
+    if (_journal && _journalMode == JournalMode::Emitted) {
+        _journal->AddNotice(*notice);
+    }
+
+    if (!_recorder) {
+        _Deliver(notice);
+        return;
+    }
+
+    const auto start = _Recorder::Now();
+
+    _Deliver(notice);
+
+    _recorder->Complete(
+        _recorderProcess,
+        UnfNotice::StageNotice::GetTypeKeyName(key),
+        "send",
+        start,
+        GetRecordArgs(*notice));
+}
+
+void Broker::_Deliver(const UnfNotice::StageNoticeRefPtr& notice)
+{
+    if (_deliveryQueue) {
+        _deliveryQueue->Push(notice);
+    }
     else {
         notice->Send(_stage);
     }
@@ -94,22 +1067,82 @@ DispatcherPtr& Broker::GetDispatcher(std::string identifier)
     return _dispatcherMap.at(identifier);
 }
 
-void Broker::Reset() { Registry.erase(_stage); }
+void Broker::Reset()
+{
+    // Deliver notices collected outside of transactions while the stage is
+    // still valid.
+    Flush();
+
+    BrokerRegistry::GetInstance().Remove(_stage);
+}
+
+void Broker::ResetAll() { BrokerRegistry::GetInstance().Clear(); }
+
+void Broker::_BeginCapture(const CapturePredicate& predicate, size_t depth)
+{
+    std::lock_guard<std::mutex> lock(_captureMutex);
+
+    // Only one concurrent transaction can be opened at a time.
+    if (_capture) {
+        return;
+    }
+
+    _capture.reset(new _ConcurrentCapture(
+        _NoticeMerger(predicate, _mergeOnCapture),
+        std::this_thread::get_id(),
+        depth));
 
-void Broker::ResetAll() { Registry.clear(); }
+    _activeCapture.store(_capture.get(), std::memory_order_release);
+}
 
-void Broker::_CleanCache()
+void Broker::_EndCapture(_NoticeMerger& merger, size_t depth)
 {
-    for (auto it = Registry.begin(); it != Registry.end();) {
-        // If the stage doesn't exist anymore, delete the corresponding
-        // broker from the registry.
-        if (it->second->GetStage().IsExpired()) {
-            it = Registry.erase(it);
+    if (!_activeCapture.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::unique_ptr<_ConcurrentCapture> capture;
+    std::vector<_CaptureGuard*> guards;
+    {
+        std::lock_guard<std::mutex> lock(_captureMutex);
+
+        if (!_capture || _capture->owner != std::this_thread::get_id()
+            || _capture->depth != depth) {
+            return;
         }
-        else {
-            it++;
+
+        capture = std::move(_capture);
+        _activeCapture.store(nullptr);
+        guards = _captureGuardList;
+    }
+
+    // Wait for threads still capturing notices into the buffers. Threads
+    // guarding buffers afterwards will find them detached.
+    for (const _CaptureGuard* guard : guards) {
+        while (guard->capture.load() == capture.get()) {
+            std::this_thread::yield();
         }
     }
+
+    // No other thread can access buffers once detached.
+    for (auto& buffer : capture->buffers) {
+        merger.Join(buffer);
+    }
+}
+
+Broker::_CaptureGuard& Broker::_GetCaptureGuard()
+{
+    bool exists;
+    _CaptureGuard& guard = _captureGuards.local(exists);
+
+    // Guards are registered so that they can be inspected while other
+    // threads create their own guards.
+    if (!exists) {
+        std::lock_guard<std::mutex> lock(_captureMutex);
+        _captureGuardList.push_back(&guard);
+    }
+
+    return guard;
 }
 
 void Broker::_DiscoverDispatchers()
@@ -128,77 +1161,297 @@ void Broker::_Add(const DispatcherPtr& dispatcher)
     _dispatcherMap[dispatcher->GetIdentifier()] = dispatcher;
 }
 
-Broker::_NoticeMerger::_NoticeMerger(CapturePredicate predicate)
-    : _predicate(std::move(predicate))
+Broker::_NoticeMerger::_NoticeMerger(
+    CapturePredicate predicate, bool mergeOnCapture)
+    : _predicate(std::move(predicate)), _mergeOnCapture(mergeOnCapture)
 {
 }
 
-void Broker::_NoticeMerger::Add(const UnfNotice::StageNoticeRefPtr& notice)
+bool Broker::_NoticeMerger::Add(
+    const UnfNotice::StageNoticeRefPtr& notice, NoticeTypeKey key)
 {
+    TRACE_FUNCTION();
+
     // Indicate whether the notice needs to be captured.
-    if (!_predicate(*notice)) return;
+    if (!_predicate(*notice, key)) return false;
 
-    // Store notices per type name, so that each type can be merged if
-    // required.
-    std::string name = notice->GetTypeId();
-    _noticeMap[name].push_back(notice);
+    _Insert(notice, key);
+    return true;
 }
 
 void Broker::_NoticeMerger::Join(_NoticeMerger& merger)
 {
-    for (auto& element : merger._noticeMap) {
-        auto& source = element.second;
-        auto& target = _noticeMap[element.first];
+    TRACE_FUNCTION();
+
+    for (auto& list : merger._noticeLists) {
+        auto& source = list.notices;
+
+        // Notices already merged in the source are accounted for.
+        _GetList(list.key).merged += list.merged;
 
-        target.reserve(target.size() + source.size());
-        std::move(
-            std::begin(source), std::end(source), std::back_inserter(target));
+        if (_mergeOnCapture) {
+            for (const auto& notice : source) {
+                _Insert(notice, list.key);
+            }
+        }
+        else {
+            auto& target = _GetList(list.key).notices;
+
+            target.reserve(target.size() + source.size());
+            std::move(
+                std::begin(source),
+                std::end(source),
+                std::back_inserter(target));
+        }
 
         source.clear();
     }
 
-    merger._noticeMap.clear();
+    merger._noticeLists.clear();
+    merger._noticeSlots.clear();
 }
 
-void Broker::_NoticeMerger::Merge()
+void Broker::_NoticeMerger::Merge(Broker& broker)
 {
-    for (auto& element : _noticeMap) {
-        auto& notices = element.second;
+    TRACE_FUNCTION();
+
+    const std::shared_ptr<_Recorder>& recorder = broker._recorder;
+
+    auto merge = [&](_NoticeList& list) {
+        auto& notices = list.notices;
 
         // If there are more than one notice for this type and
         // if the notices are mergeable, we only need to keep the
         // first notice, and all other can be pruned.
-        if (notices.size() > 1 && notices[0]->IsMergeable()) {
-            auto& notice = notices.at(0);
-            auto it = std::next(notices.begin());
+        if (notices.size() < 2 || !notices[0]->IsMergeable()) {
+            return;
+        }
+
+        _Recorder::TimePoint start;
+        const size_t count = notices.size();
+        if (recorder) {
+            start = _Recorder::Now();
+        }
+
+        // The scope is only labelled with the notice type when traces are
+        // collected, as the label needs to be built dynamically.
+        if (TraceCollector::IsEnabled()) {
+            TRACE_SCOPE_DYNAMIC(
+                "Merge " + UnfNotice::StageNotice::GetTypeKeyName(list.key));
+            _Merge(list);
+        }
+        else {
+            _Merge(list);
+        }
 
-            while (it != notices.end()) {
-                // Attempt to merge content of notice with first notice
-                // if this is possible.
+        // Record number of notices merged and number of paths of the
+        // resulting notice.
+        if (recorder) {
+            recorder->Complete(
+                broker._recorderProcess,
+                UnfNotice::StageNotice::GetTypeKeyName(list.key),
+                "merge",
+                start,
+                "\"notices\": " + std::to_string(count) + ", "
+                    + GetRecordArgs(*notices[0]));
+        }
+    };
+
+    // Each list only holds notices of a single type, so lists can be merged
+    // independently from each other.
+    if (_IsParallel()) {
+        tbb::parallel_for(
+            size_t(0), _noticeLists.size(), [&](size_t index) {
+                merge(_noticeLists[index]);
+            });
+    }
+    else {
+        for (auto& list : _noticeLists) {
+            merge(list);
+        }
+    }
+}
+
+void Broker::_NoticeMerger::_Merge(_NoticeList& list)
+{
+    auto& notices = list.notices;
+    auto& notice = notices.at(0);
+
+    if (notices.size() >= ParallelReduceThreshold
+        && notice->IsMergeAssociative() && IsDistinct(notices)) {
+        _Reduce(notices);
+    }
+    else {
+        for (auto it = std::next(notices.begin()); it != notices.end(); ++it) {
+            // Attempt to merge content of notice with first notice
+            // if this is possible.
+            if (*it != notice) {
                 notice->Merge(std::move(**it));
-                it = notices.erase(it);
             }
         }
     }
+
+    // Release all merged notices at once.
+    list.merged += notices.size() - 1;
+    notices.erase(std::next(notices.begin()), notices.end());
+}
+
+void Broker::_NoticeMerger::_Reduce(_NoticePtrList& notices)
+{
+    using Range = tbb::blocked_range<size_t>;
+    using NoticePtr = UnfNotice::StageNoticeRefPtr;
+
+    // Each task merges a contiguous range of notices into the first notice
+    // of the range, and results of adjacent ranges are joined from left to
+    // right, so that notices are still merged in their capture order and the
+    // first notice receives the final result.
+    notices[0] = tbb::parallel_reduce(
+        Range(0, notices.size(), ParallelReduceGrainSize),
+        NoticePtr(),
+        [&](const Range& range, NoticePtr notice) {
+            for (size_t index = range.begin(); index < range.end(); ++index) {
+                if (!notice) {
+                    notice = notices[index];
+                }
+                else {
+                    notice->Merge(std::move(*notices[index]));
+                }
+            }
+            return notice;
+        },
+        [](NoticePtr left, const NoticePtr& right) {
+            if (!left) {
+                return right;
+            }
+            if (right) {
+                left->Merge(std::move(*right));
+            }
+            return left;
+        });
+}
+
+void Broker::_NoticeMerger::_Insert(
+    const UnfNotice::StageNoticeRefPtr& notice, NoticeTypeKey key)
+{
+    // Store notices per type key, so that each type can be merged if
+    // required.
+    auto& list = _GetList(key);
+    auto& notices = list.notices;
+
+    // Fold notice into the first notice of the same type if notices are
+    // merged as soon as they are captured.
+    if (_mergeOnCapture && !notices.empty() && notices[0]->IsMergeable()) {
+        if (notices[0] != notice) {
+            notices[0]->Merge(std::move(*notice));
+        }
+        list.merged++;
+        return;
+    }
+
+    notices.push_back(notice);
 }
 
-void Broker::_NoticeMerger::PostProcess()
+Broker::_NoticeMerger::_NoticeList& Broker::_NoticeMerger::_GetList(
+    NoticeTypeKey key)
 {
-    for (auto& element : _noticeMap) {
-        auto& notice = element.second[0];
+    static constexpr size_t noSlot = static_cast<size_t>(-1);
+
+    // Type keys are attributed in sequence, so slots can be stored densely.
+    if (key >= _noticeSlots.size()) {
+        _noticeSlots.resize(key + 1, noSlot);
+    }
+
+    size_t& slot = _noticeSlots[key];
+    if (slot == noSlot) {
+        slot = _noticeLists.size();
+        _noticeLists.emplace_back(key);
+    }
+
+    return _noticeLists[slot];
+}
+
+void Broker::_NoticeMerger::PostProcess(Broker& broker)
+{
+    TRACE_FUNCTION();
+
+    const std::shared_ptr<_Recorder>& recorder = broker._recorder;
+
+    auto postProcess = [&](_NoticeList& list) {
+        auto& notice = list.notices[0];
+
+        if (!recorder) {
+            notice->PostProcess();
+            return;
+        }
+
+        const auto start = _Recorder::Now();
+
         notice->PostProcess();
+
+        recorder->Complete(
+            broker._recorderProcess,
+            UnfNotice::StageNotice::GetTypeKeyName(list.key),
+            "postProcess",
+            start,
+            GetRecordArgs(*notice));
+    };
+
+    if (_IsParallel()) {
+        tbb::parallel_for(
+            size_t(0), _noticeLists.size(), [&](size_t index) {
+                postProcess(_noticeLists[index]);
+            });
+    }
+    else {
+        for (auto& list : _noticeLists) {
+            postProcess(list);
+        }
     }
 }
 
-void Broker::_NoticeMerger::Send(const UsdStageWeakPtr& stage)
+bool Broker::_NoticeMerger::_IsParallel() const
 {
-    for (auto& element : _noticeMap) {
-        auto& notices = element.second;
+    if (_noticeLists.size() < 2) {
+        return false;
+    }
+
+    // Notices already folded on capture are accounted for, as they reflect
+    // the amount of work performed by merges of the same transaction.
+    size_t count = 0;
+    for (const auto& list : _noticeLists) {
+        count += list.notices.size() + list.merged;
+    }
+
+    return count >= ParallelMergeThreshold;
+}
+
+void Broker::_NoticeMerger::Send(Broker& broker)
+{
+    TRACE_FUNCTION();
+
+    // Gather notices emitted for batch listeners if necessary.
+    const bool batching = broker._HasBatchListeners();
+    _NoticePtrList batch;
+
+    for (auto& list : _noticeLists) {
+        auto& notices = list.notices;
 
         // Send all remaining notices.
-        for (const auto& notice : element.second) {
-            notice->Send(stage);
+        for (const auto& notice : notices) {
+            broker._Emit(notice, list.key);
+        }
+
+        if (batching) {
+            batch.insert(batch.end(), notices.begin(), notices.end());
         }
+
+        broker._statistics->Add(list.key, _Statistics::Merged, list.merged);
+        broker._statistics->Add(
+            list.key, _Statistics::Sent, notices.size());
+    }
+
+    if (!batch.empty()) {
+        broker._SendBatch(batch);
     }
 }
 
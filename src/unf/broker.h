@@ -16,18 +16,26 @@
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/common.h>
 #include <pxr/usd/usd/stage.h>
+#include <tbb/enumerable_thread_specific.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <typeinfo>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace unf {
 
 class Broker;
 class Dispatcher;
+class JournalWriter;
 
 /// Convenient alias for Broker reference pointer.
 using BrokerPtr = PXR_NS::TfRefPtr<Broker>;
@@ -38,6 +46,121 @@ using BrokerWeakPtr = PXR_NS::TfWeakPtr<Broker>;
 /// Convenient alias for Dispatcher reference pointer.
 using DispatcherPtr = PXR_NS::TfRefPtr<Dispatcher>;
 
+/// Convenient alias for function returning the current time.
+using ClockFunc = std::function<std::chrono::steady_clock::time_point()>;
+
+/// Convenient alias for function receiving a batch of notices.
+using BatchListenerFunc =
+    std::function<void(const std::vector<UnfNotice::StageNoticeRefPtr>&)>;
+
+/// Convenient alias for identifier of a batch listener.
+using BatchListenerKey = std::size_t;
+
+/// \brief
+/// Indicate which threads a notice transaction captures notices from.
+enum class TransactionScope {
+    /// Capture notices sent from the thread which started the transaction.
+    Thread,
+
+    /// Capture notices sent from the thread which started the transaction,
+    /// and from any other thread which has not started a transaction.
+    Concurrent
+};
+
+/// \brief
+/// Indicate which notices are recorded in a journal.
+enum class JournalMode {
+    /// Record notices emitted to listeners.
+    Emitted,
+
+    /// Record notices sent via the broker before they are captured, as well
+    /// as transaction boundaries.
+    Captured
+};
+
+/// \brief
+/// Counters describing notices of one type processed by a broker.
+struct NoticeStatistics {
+    /// Name of the notice type.
+    std::string typeName;
+
+    /// Number of notices sent via the broker.
+    uint64_t received = 0;
+
+    /// Number of notices captured by a transaction.
+    uint64_t captured = 0;
+
+    /// Number of notices rejected by the predicate of a transaction.
+    uint64_t filtered = 0;
+
+    /// Number of notices merged into another notice of the same type.
+    uint64_t merged = 0;
+
+    /// Number of notices emitted to listeners.
+    uint64_t sent = 0;
+};
+
+/// \brief
+/// Approximated distribution of the time spent delivering notices of one
+/// type.
+struct LatencyStatistics {
+    /// Name of the notice type.
+    std::string typeName;
+
+    /// \brief
+    /// Name of the listener type.
+    ///
+    /// An empty name indicates that durations correspond to the delivery of
+    /// each notice to all listeners.
+    std::string listenerName;
+
+    /// Number of durations recorded.
+    uint64_t count = 0;
+
+    /// Median duration.
+    std::chrono::nanoseconds p50{0};
+
+    /// 99th percentile duration.
+    std::chrono::nanoseconds p99{0};
+
+    /// Maximum duration.
+    std::chrono::nanoseconds max{0};
+};
+
+/// \brief
+/// Counters and cumulative times describing the work performed by a broker.
+struct BrokerStatistics {
+    /// Counters for each notice type sent via the broker.
+    std::vector<NoticeStatistics> notices;
+
+    /// \brief
+    /// Time spent capturing notices within transactions.
+    ///
+    /// Times are only recorded when time tracking is enabled.
+    /// \sa Broker::SetTimeTracking
+    std::chrono::nanoseconds captureTime{0};
+
+    /// Time spent merging captured notices.
+    std::chrono::nanoseconds mergeTime{0};
+
+    /// Time spent post-processing merged notices.
+    std::chrono::nanoseconds postProcessTime{0};
+
+    /// \brief
+    /// Time spent emitting notices.
+    ///
+    /// This includes the time spent in listeners unless notices are
+    /// delivered asynchronously.
+    std::chrono::nanoseconds sendTime{0};
+
+    /// \brief
+    /// Delivery latencies for each notice type and each listener.
+    ///
+    /// Latencies are only recorded when latency tracking is enabled.
+    /// \sa Broker::SetLatencyTracking
+    std::vector<LatencyStatistics> latencies;
+};
+
 /// \class Broker
 ///
 /// \brief
@@ -50,9 +173,13 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     ///
     /// If a broker has already been created from this \p stage, it will be
     /// returned. Otherwise, a new one will be created and returned.
+    ///
+    /// \note
+    /// Brokers can be created, reset and retrieved concurrently from
+    /// multiple threads.
     UNF_API static BrokerPtr Create(const PXR_NS::UsdStageWeakPtr& stage);
 
-    UNF_API virtual ~Broker() = default;
+    UNF_API virtual ~Broker();
 
     /// Remove default copy constructor.
     UNF_API Broker(const Broker&) = delete;
@@ -64,7 +191,9 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     UNF_API const PXR_NS::UsdStageWeakPtr GetStage() const { return _stage; }
 
     /// \brief
-    /// Indicate whether a notice transaction has been started.
+    /// Indicate whether a notice transaction has been started from the
+    /// calling thread, or whether notices sent from the calling thread are
+    /// captured by a concurrent transaction.
     /// \sa BeginTransaction
     UNF_API bool IsInTransaction();
 
@@ -74,6 +203,19 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     /// Notices derived from UnfNotice::StageNotice will be held during
     /// the transaction and emitted at the end.
     ///
+    /// Transactions are scoped to the calling thread: only notices sent
+    /// from this thread are captured by the transaction, and notices sent
+    /// from other threads are not affected. Several threads can therefore
+    /// author the same stage within their own transactions.
+    ///
+    /// If \p scope is TransactionScope::Concurrent, notices sent from any
+    /// other thread which has not started a transaction are also captured.
+    /// Each thread captures notices in its own buffer, which are joined at
+    /// the end of the transaction. The \p predicate must then be safe to
+    /// invoke from multiple threads. Only one concurrent transaction can be
+    /// opened at a time for a broker; otherwise, the transaction is scoped
+    /// to the calling thread.
+    ///
     /// By default, all UnfNotice::StageNotice notices will be captured during
     /// the entire scope of the transaction. A CapturePredicate can be passed to
     /// influence which notices are captured. Notices that are not captured
@@ -87,7 +229,8 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     /// \sa EndTransaction
     /// \sa NoticeTransaction
     UNF_API void BeginTransaction(
-        CapturePredicate predicate = CapturePredicate::Default());
+        CapturePredicate predicate = CapturePredicate::Default(),
+        TransactionScope scope = TransactionScope::Thread);
 
     /// \brief
     /// Start a notice transaction with a capture predicate function.
@@ -97,7 +240,7 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     ///
     /// \code{.cpp}
     /// broker->BeginTransaction([&](const unf::UnfNotice::StageNotice& n) {
-    ///     return (n.GetTypeId() != typeid(Foo).name());
+    ///     return (n.GetTypeKey() != Foo::StaticTypeKey());
     /// });
     /// \endcode
     ///
@@ -108,7 +251,9 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     ///
     /// \sa EndTransaction
     /// \sa NoticeTransaction
-    UNF_API void BeginTransaction(const CapturePredicateFunc&);
+    UNF_API void BeginTransaction(
+        const CapturePredicateFunc&,
+        TransactionScope scope = TransactionScope::Thread);
 
     /// \brief
     /// Stop a notice transaction.
@@ -125,6 +270,122 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     /// \sa NoticeTransaction
     UNF_API void EndTransaction();
 
+    /// \brief
+    /// Indicate whether notices are merged as soon as they are captured.
+    /// \sa SetMergeOnCapture
+    UNF_API bool GetMergeOnCapture() const { return _mergeOnCapture; }
+
+    /// \brief
+    /// Set whether notices are merged as soon as they are captured.
+    ///
+    /// By default, notices captured during a transaction are held until the
+    /// end of the transaction, where notices of each type are consolidated.
+    /// When this mode is enabled, each mergeable notice captured is folded
+    /// into the first notice captured with the same type. Memory usage during
+    /// long transactions is then proportional to the consolidated notices
+    /// rather than to the number of notices captured, and ending the
+    /// transaction only needs to post-process and send consolidated notices.
+    ///
+    /// \note
+    /// The mode only applies to transactions started after this call.
+    UNF_API void SetMergeOnCapture(bool enabled) { _mergeOnCapture = enabled; }
+
+    /// \brief
+    /// Indicate whether notices are delivered on a background thread.
+    /// \sa SetAsyncDelivery
+    UNF_API bool GetAsyncDelivery() const;
+
+    /// \brief
+    /// Set whether notices are delivered on a background thread.
+    ///
+    /// By default, notices are sent synchronously from the thread which
+    /// sends them via the broker, or which ends the transaction. When this
+    /// mode is enabled, notices are queued and delivered to listeners from a
+    /// dedicated thread, so that expensive listeners do not stall the
+    /// authoring thread. Notices are delivered in the order in which they
+    /// have been queued.
+    ///
+    /// Disabling this mode waits for all pending notices to be delivered.
+    /// Pending notices are dropped if the broker is destroyed once its stage
+    /// has expired.
+    ///
+    /// \note
+    /// Listeners are invoked from the delivery thread and must be safe to
+    /// call from a thread other than the authoring thread.
+    ///
+    /// \warning
+    /// This mode should not be changed while notices are being sent from
+    /// other threads.
+    ///
+    /// \sa WaitForDelivery
+    UNF_API void SetAsyncDelivery(bool enabled);
+
+    /// \brief
+    /// Block until all notices queued for asynchronous delivery have been
+    /// delivered.
+    ///
+    /// Return immediately if asynchronous delivery is disabled, or if called
+    /// from a listener on the delivery thread.
+    ///
+    /// \sa SetAsyncDelivery
+    UNF_API void WaitForDelivery();
+
+    /// \brief
+    /// Collect notices sent outside of transactions and deliver them in
+    /// consolidated batches.
+    ///
+    /// Notices sent via the broker outside of a transaction are captured by
+    /// an implicit transaction, which is ended once no notices have been
+    /// sent for \p quietPeriod, or once \p maxLatency has elapsed since the
+    /// first notice was captured. This reduces listener invocations when
+    /// notices are sent in bursts without explicit transactions.
+    ///
+    /// Elapsed periods are evaluated each time a notice is sent and when
+    /// Poll is called. Pending notices are therefore only delivered when the
+    /// quiet period elapses if Poll is called periodically, for instance
+    /// from the event loop of the host application.
+    ///
+    /// By default, time is measured with \c std::chrono::steady_clock. A
+    /// \p clock function can be passed to measure time differently.
+    ///
+    /// Pending notices are not delivered when the broker is destroyed.
+    ///
+    /// \sa DisableDebounce
+    /// \sa Poll
+    UNF_API void EnableDebounce(
+        std::chrono::milliseconds quietPeriod,
+        std::chrono::milliseconds maxLatency,
+        const ClockFunc& clock = nullptr);
+
+    /// \brief
+    /// Stop collecting notices sent outside of transactions.
+    ///
+    /// Pending notices are delivered.
+    ///
+    /// \sa EnableDebounce
+    UNF_API void DisableDebounce();
+
+    /// \brief
+    /// Indicate whether notices sent outside of transactions are collected.
+    /// \sa EnableDebounce
+    UNF_API bool IsDebounceEnabled() const;
+
+    /// \brief
+    /// Deliver pending notices collected outside of transactions if the
+    /// quiet period or the maximum latency has elapsed.
+    ///
+    /// Return whether notices have been delivered.
+    ///
+    /// \sa EnableDebounce
+    UNF_API bool Poll();
+
+    /// \brief
+    /// Deliver pending notices collected outside of transactions
+    /// immediately.
+    ///
+    /// \sa EnableDebounce
+    UNF_API void Flush();
+
     /// \brief
     /// Create and send a UnfNotice::StageNotice notice via the broker.
     ///
@@ -140,6 +401,162 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     /// The associated stage will be used as sender.
     UNF_API void Send(const UnfNotice::StageNoticeRefPtr&);
 
+    /// \brief
+    /// Register a function receiving notices emitted by the broker in
+    /// batches, and return a key to remove it.
+    ///
+    /// All notices emitted at the end of an outermost transaction are
+    /// received in a single call once they have been merged and
+    /// post-processed, in the order in which they are emitted. This allows
+    /// listeners to reconcile notices of several types in a single pass.
+    /// Notices delivered at the end of an implicit transaction are batched
+    /// as well when debouncing is enabled, whereas notices emitted outside
+    /// of transactions are received individually.
+    ///
+    /// The function is invoked on the thread which emits the notices, after
+    /// they have been sent to regular listeners, or queued if asynchronous
+    /// delivery is enabled.
+    ///
+    /// \sa RemoveBatchListener
+    UNF_API BatchListenerKey AddBatchListener(const BatchListenerFunc&);
+
+    /// \brief
+    /// Remove function registered with \p key.
+    ///
+    /// The function can be removed while it is invoked.
+    ///
+    /// \sa AddBatchListener
+    UNF_API void RemoveBatchListener(BatchListenerKey key);
+
+    /// \brief
+    /// Return counters and cumulative times describing the notices
+    /// processed by the broker.
+    ///
+    /// Counters are always recorded, in storage local to each thread, and
+    /// summed when queried. Statistics can be queried while notices are sent
+    /// from other threads, in which case counters might not be consistent
+    /// with each other. Cumulative times are only recorded when time
+    /// tracking is enabled.
+    ///
+    /// \sa ResetStatistics
+    /// \sa SetTimeTracking
+    UNF_API BrokerStatistics GetStatistics() const;
+
+    /// Reset all counters, cumulative times and latencies.
+    UNF_API void ResetStatistics();
+
+    /// \brief
+    /// Indicate whether the time spent in each phase of the notice flow is
+    /// recorded.
+    /// \sa SetTimeTracking
+    UNF_API bool GetTimeTracking() const;
+
+    /// \brief
+    /// Set whether the time spent in each phase of the notice flow is
+    /// recorded.
+    ///
+    /// When this mode is enabled, the time spent capturing, merging,
+    /// post-processing and emitting notices is accumulated and returned by
+    /// GetStatistics. It is disabled by default, as measuring time reads the
+    /// clock twice for each notice captured or sent.
+    UNF_API void SetTimeTracking(bool enabled);
+
+    /// \brief
+    /// Indicate whether delivery latencies are recorded.
+    /// \sa SetLatencyTracking
+    UNF_API bool GetLatencyTracking() const;
+
+    /// \brief
+    /// Set whether delivery latencies are recorded.
+    ///
+    /// When this mode is enabled, the time spent delivering each notice
+    /// emitted for the stage is recorded, as well as the time spent in each
+    /// listener invoked. Durations are aggregated into histograms per notice
+    /// type and per listener type, which are returned by GetStatistics.
+    ///
+    /// Listeners are measured with a PXR_NS::TfNotice::Probe, which is
+    /// invoked for every notice sent within the process while this mode is
+    /// enabled. It is therefore intended for profiling sessions.
+    ///
+    /// \warning
+    /// This mode should not be changed while notices are being sent from
+    /// other threads.
+    UNF_API void SetLatencyTracking(bool enabled);
+
+    /// \brief
+    /// Start recording the activity of the broker into a Chrome trace file.
+    ///
+    /// Transactions, captures, merges, post-processing and emissions are
+    /// timestamped along with the notice type and the number of paths
+    /// affected, and written as a Chrome trace JSON file at \p filePath. The
+    /// file is completed when the recording is stopped, and can be
+    /// visualized with Perfetto or the \c chrome://tracing page.
+    ///
+    /// Recording can also be enabled for all brokers by setting the
+    /// \c UNF_TRACE_FILE environment variable to the file path, in which
+    /// case a single file is completed once all brokers are destroyed.
+    /// Brokers created afterwards record into a new file, with a session
+    /// number inserted before the extension of the file path.
+    ///
+    /// \note
+    /// Events are written into the file as they are recorded. Nothing is
+    /// recorded if the file cannot be created.
+    ///
+    /// \warning
+    /// Recording should not be started or stopped while notices are being
+    /// sent from other threads.
+    ///
+    /// \sa StopRecording
+    UNF_API void StartRecording(const std::string& filePath);
+
+    /// \brief
+    /// Stop recording the activity of the broker.
+    ///
+    /// The file is completed unless the recording is shared with other
+    /// brokers via the \c UNF_TRACE_FILE environment variable.
+    ///
+    /// \sa StartRecording
+    UNF_API void StopRecording();
+
+    /// \brief
+    /// Indicate whether the activity of the broker is recorded.
+    /// \sa StartRecording
+    UNF_API bool IsRecording() const;
+
+    /// \brief
+    /// Start recording notices into a journal file.
+    ///
+    /// With JournalMode::Emitted, notices emitted to listeners are recorded.
+    /// With JournalMode::Captured, notices sent via the broker are recorded
+    /// before being captured and merged, along with transaction boundaries,
+    /// so that merges can be reproduced.
+    ///
+    /// Each notice is timestamped and encoded with unf::SerializeNotice into
+    /// the file at \p filePath. Notice types which do not support
+    /// serialization are not recorded. The journal can be read with a
+    /// JournalReader, or replayed with the \c unf_replay tool.
+    ///
+    /// \note
+    /// Transaction predicates and scopes are not recorded.
+    ///
+    /// \warning
+    /// Journaling should not be started or stopped while notices are being
+    /// sent from other threads.
+    ///
+    /// \sa StopJournal
+    UNF_API void StartJournal(
+        const std::string& filePath, JournalMode mode = JournalMode::Emitted);
+
+    /// \brief
+    /// Stop recording notices into a journal file and close the file.
+    /// \sa StartJournal
+    UNF_API void StopJournal();
+
+    /// \brief
+    /// Indicate whether notices are recorded into a journal file.
+    /// \sa StartJournal
+    UNF_API bool IsJournaling() const;
+
     /// Return dispatcher reference associated with \p identifier.
     UNF_API DispatcherPtr& GetDispatcher(std::string identifier);
 
@@ -153,19 +570,21 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     /// \brief
     /// Un-register broker.
     ///
+    /// Notices collected outside of transactions are delivered first.
+    ///
     /// \warning
     /// The broker is not safe to use after this call.
     UNF_API void Reset();
 
+    /// \brief
     /// Un-register all brokers.
+    ///
+    /// Notices collected outside of transactions are dropped.
     UNF_API static void ResetAll();
 
   private:
     Broker(const PXR_NS::UsdStageWeakPtr&);
 
-    /// Un-register brokers targeting expired stages.
-    static void _CleanCache();
-
     /// Discover all dispatchers registered as plugins.
     void _DiscoverDispatchers();
 
@@ -181,44 +600,229 @@ class Broker : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     template <class OutputPtr, class OutputFactory>
     void _LoadFromPlugins(const PXR_NS::TfType& type);
 
-    struct UsdStageWeakPtrHasher {
-        std::size_t operator()(const PXR_NS::UsdStageWeakPtr& ptr) const
-        {
-            return hash_value(ptr);
-        }
-    };
-
-    /// Record each hashed stage pointer to its corresponding broker pointer.
-    static std::unordered_map<
-        PXR_NS::UsdStageWeakPtr, BrokerPtr, UsdStageWeakPtrHasher>
-        Registry;
-
     class _NoticeMerger {
       public:
-        _NoticeMerger(CapturePredicate predicate = CapturePredicate::Default());
+        _NoticeMerger(
+            CapturePredicate predicate = CapturePredicate::Default(),
+            bool mergeOnCapture = false);
 
-        void Add(const UnfNotice::StageNoticeRefPtr&);
+        /// Record notice with type \p key if the predicate accepts it, and
+        /// return whether the notice has been captured.
+        bool Add(const UnfNotice::StageNoticeRefPtr&, NoticeTypeKey key);
         void Join(_NoticeMerger&);
-        void Merge();
-        void PostProcess();
-        void Send(const PXR_NS::UsdStageWeakPtr&);
+
+        /// Merge notices of each type, and record each merge into the
+        /// recorder of \p broker if its activity is recorded.
+        void Merge(Broker& broker);
+
+        /// Post-process notices of each type, and record each post-process
+        /// into the recorder of \p broker if its activity is recorded.
+        void PostProcess(Broker& broker);
+
+        void Send(Broker&);
 
       private:
         using _NoticePtrList = std::vector<UnfNotice::StageNoticeRefPtr>;
-        using _NoticePtrMap = std::unordered_map<std::string, _NoticePtrList>;
 
-        _NoticePtrMap _noticeMap;
+        struct _NoticeList {
+            _NoticeList(NoticeTypeKey key) : key(key) {}
+
+            NoticeTypeKey key;
+            _NoticePtrList notices;
+
+            /// Number of notices merged into other notices of the list.
+            size_t merged = 0;
+        };
+
+        using _NoticeLists = std::vector<_NoticeList>;
+
+        /// Record notice with type \p key without applying the predicate.
+        void _Insert(const UnfNotice::StageNoticeRefPtr&, NoticeTypeKey key);
+
+        /// \brief
+        /// Return list of notices with type \p key.
+        ///
+        /// The list is appended if no notices with this type have been
+        /// recorded yet.
+        _NoticeList& _GetList(NoticeTypeKey key);
+
+        /// Merge all notices of \p list into its first notice.
+        static void _Merge(_NoticeList& list);
+
+        /// \brief
+        /// Merge all \p notices into the first notice with a parallel
+        /// reduction.
+        ///
+        /// Notices must be distinct and their merge associative.
+        static void _Reduce(_NoticePtrList& notices);
+
+        /// \brief
+        /// Indicate whether lists of distinct types should be processed
+        /// concurrently.
+        ///
+        /// Small transactions are processed sequentially as scheduling tasks
+        /// would cost more than the work saved.
+        bool _IsParallel() const;
+
+        /// Lists of notices per type, ordered by first capture of each type.
+        _NoticeLists _noticeLists;
+
+        /// Position of each list within _noticeLists, indexed by type key.
+        std::vector<size_t> _noticeSlots;
+
         CapturePredicate _predicate;
+        bool _mergeOnCapture;
+    };
+
+    /// Buffers capturing notices sent from threads without transactions
+    /// while a concurrent transaction is opened.
+    struct _ConcurrentCapture {
+        _ConcurrentCapture(
+            const _NoticeMerger& exemplar, std::thread::id owner, size_t depth)
+            : buffers(exemplar), owner(owner), depth(depth)
+        {
+        }
+
+        tbb::enumerable_thread_specific<_NoticeMerger> buffers;
+
+        /// Thread which started the concurrent transaction.
+        std::thread::id owner;
+
+        /// Index of the concurrent transaction within the owner stack.
+        size_t depth;
+    };
+
+    /// Concurrent transaction buffers in use by a sending thread, which
+    /// cannot be detached until released.
+    struct _CaptureGuard {
+        std::atomic<_ConcurrentCapture*> capture{nullptr};
     };
 
+    /// Return guard of the calling thread.
+    _CaptureGuard& _GetCaptureGuard();
+
+    /// Queue of notices delivered on a dedicated thread.
+    class _DeliveryQueue;
+
+    /// Send notice to listeners, or queue it if asynchronous delivery is
+    /// enabled.
+    void _Deliver(const UnfNotice::StageNoticeRefPtr&);
+
+    /// Deliver notice with type \p key and record its emission if the
+    /// activity of the broker is recorded.
+    void _Emit(const UnfNotice::StageNoticeRefPtr&, NoticeTypeKey key);
+
+    /// Implicit transaction collecting notices outside of transactions.
+    class _Debouncer;
+
+    /// Deliver notices collected by \p merger.
+    void _Process(_NoticeMerger& merger);
+
+    /// Indicate whether batch listeners are registered.
+    bool _HasBatchListeners() const
+    {
+        return _batchListenerCount.load(std::memory_order_acquire) > 0;
+    }
+
+    /// Invoke batch listeners with \p notices.
+    void _SendBatch(const std::vector<UnfNotice::StageNoticeRefPtr>& notices);
+
+    /// Record \p notice with type \p key within \p merger.
+    void _Capture(
+        _NoticeMerger& merger,
+        const UnfNotice::StageNoticeRefPtr& notice,
+        NoticeTypeKey key);
+
+    /// Counters and cumulative times recorded by the broker.
+    class _Statistics;
+
+    /// Probe recording delivery latencies.
+    class _LatencyProbe;
+
+    /// Chrome trace recorder of the broker activity.
+    class _Recorder;
+
+    /// Record activity into \p recorder, or stop recording if null.
+    void _SetRecorder(const std::shared_ptr<_Recorder>& recorder);
+
+    /// Record capture of \p notice with type \p key.
+    void _RecordCapture(
+        const UnfNotice::StageNotice& notice, NoticeTypeKey key, bool captured);
+
+    /// Start capturing notices from threads without transactions.
+    void _BeginCapture(const CapturePredicate&, size_t depth);
+
+    /// Stop capturing notices from threads without transactions and join
+    /// captured notices into \p merger if the transaction at \p depth of
+    /// the calling thread started the capture.
+    void _EndCapture(_NoticeMerger& merger, size_t depth);
+
     /// Usd Stage associated with broker.
     PXR_NS::UsdStageWeakPtr _stage;
 
-    /// List of NoticeMerger objects which handle transactions.
-    std::vector<_NoticeMerger> _mergers;
+    /// Indicate whether notices are merged as soon as they are captured.
+    bool _mergeOnCapture = false;
+
+    /// List of NoticeMerger objects which handle transactions started from
+    /// each thread.
+    tbb::enumerable_thread_specific<std::vector<_NoticeMerger> > _mergers;
+
+    /// Probe recording delivery latencies, if latency tracking has been
+    /// enabled once.
+    std::unique_ptr<_LatencyProbe> _latencyProbe;
+
+    /// Recorder of the broker activity, if enabled.
+    std::shared_ptr<_Recorder> _recorder;
+
+    /// Identifier of the broker within the recorder.
+    size_t _recorderProcess = 0;
+
+    /// Journal recording notices, if enabled.
+    std::unique_ptr<JournalWriter> _journal;
+
+    /// Indicate which notices are recorded in the journal.
+    JournalMode _journalMode = JournalMode::Emitted;
+
+    /// Queue of notices delivered asynchronously, if enabled.
+    std::unique_ptr<_DeliveryQueue> _deliveryQueue;
+
+    /// Implicit transaction collecting notices, if enabled.
+    std::unique_ptr<_Debouncer> _debouncer;
+
+    /// Statistics recorded by the broker.
+    std::unique_ptr<_Statistics> _statistics;
+
+    /// Buffers of the opened concurrent transaction, if any.
+    std::unique_ptr<_ConcurrentCapture> _capture;
+
+    /// Buffers of the opened concurrent transaction published to sending
+    /// threads, which can be read without locking.
+    std::atomic<_ConcurrentCapture*> _activeCapture{nullptr};
+
+    /// Concurrent transaction buffers in use by each sending thread.
+    tbb::enumerable_thread_specific<_CaptureGuard> _captureGuards;
+
+    /// Guards of all threads which captured notices concurrently.
+    std::vector<_CaptureGuard*> _captureGuardList;
+
+    /// Guard creation and removal of concurrent transaction buffers.
+    std::mutex _captureMutex;
 
     /// List of registered Dispatchers.
     std::unordered_map<std::string, DispatcherPtr> _dispatcherMap;
+
+    /// Functions receiving batches of notices, with their keys.
+    std::vector<std::pair<BatchListenerKey, BatchListenerFunc> >
+        _batchListeners;
+
+    /// Key attributed to the last batch listener registered.
+    BatchListenerKey _batchListenerKey = 0;
+
+    /// Number of batch listeners, which can be read without locking.
+    std::atomic<size_t> _batchListenerCount{0};
+
+    /// Guard access to batch listeners.
+    std::mutex _batchListenerMutex;
 };
 
 template <class UnfNotice, class... Args>
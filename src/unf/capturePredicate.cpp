@@ -4,6 +4,7 @@
 #include <functional>
 #include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace unf {
@@ -13,22 +14,121 @@ CapturePredicate::CapturePredicate(const CapturePredicateFunc& function)
 {
 }
 
+CapturePredicate::CapturePredicate(std::vector<_Word> words, bool fallback)
+    : _words(std::move(words)), _fallback(fallback)
+{
+}
+
 bool CapturePredicate::operator()(const UnfNotice::StageNotice& notice) const
 {
-    if (!_function) return true;
-    return _function(notice);
+    if (_function) return _function(notice);
+    return _Test(notice.GetTypeKey());
 }
 
 CapturePredicate CapturePredicate::Default()
 {
-    auto function = [](const UnfNotice::StageNotice&) { return true; };
-    return CapturePredicate(function);
+    return CapturePredicate(std::vector<_Word>(), true);
 }
 
 CapturePredicate CapturePredicate::BlockAll()
 {
-    auto function = [](const UnfNotice::StageNotice&) { return false; };
-    return CapturePredicate(function);
+    return CapturePredicate(std::vector<_Word>(), false);
+}
+
+CapturePredicate CapturePredicate::IncludeTypes(
+    const std::vector<NoticeTypeKey>& keys)
+{
+    return _FromKeys(keys, false);
+}
+
+CapturePredicate CapturePredicate::ExcludeTypes(
+    const std::vector<NoticeTypeKey>& keys)
+{
+    return _FromKeys(keys, true);
+}
+
+CapturePredicate CapturePredicate::operator&(
+    const CapturePredicate& other) const
+{
+    if (_function || other._function) {
+        CapturePredicate self = *this;
+        return CapturePredicate(
+            [=](const UnfNotice::StageNotice& notice) {
+                return self(notice) && other(notice);
+            });
+    }
+
+    return _Combine(other, std::bit_and<_Word>());
+}
+
+CapturePredicate CapturePredicate::operator|(
+    const CapturePredicate& other) const
+{
+    if (_function || other._function) {
+        CapturePredicate self = *this;
+        return CapturePredicate(
+            [=](const UnfNotice::StageNotice& notice) {
+                return self(notice) || other(notice);
+            });
+    }
+
+    return _Combine(other, std::bit_or<_Word>());
+}
+
+CapturePredicate CapturePredicate::operator~() const
+{
+    if (_function) {
+        CapturePredicateFunc function = _function;
+        return CapturePredicate([=](const UnfNotice::StageNotice& notice) {
+            return !function(notice);
+        });
+    }
+
+    std::vector<_Word> words(_words.size());
+    std::transform(
+        _words.begin(), _words.end(), words.begin(), std::bit_not<_Word>());
+
+    return CapturePredicate(std::move(words), !_fallback);
+}
+
+CapturePredicate CapturePredicate::_FromKeys(
+    const std::vector<NoticeTypeKey>& keys, bool fallback)
+{
+    size_t size = 0;
+    for (NoticeTypeKey key : keys) {
+        size = std::max(size, key / _wordSize + 1);
+    }
+
+    std::vector<_Word> words(size, fallback ? ~_Word(0) : _Word(0));
+
+    for (NoticeTypeKey key : keys) {
+        const _Word mask = _Word(1) << (key % _wordSize);
+
+        if (fallback) {
+            words[key / _wordSize] &= ~mask;
+        }
+        else {
+            words[key / _wordSize] |= mask;
+        }
+    }
+
+    return CapturePredicate(std::move(words), fallback);
+}
+
+template <class Operation>
+CapturePredicate CapturePredicate::_Combine(
+    const CapturePredicate& other, Operation operation) const
+{
+    const size_t size = std::max(_words.size(), other._words.size());
+
+    std::vector<_Word> words(size);
+    for (size_t i = 0; i < size; ++i) {
+        words[i] = operation(_GetWord(i), other._GetWord(i));
+    }
+
+    const bool fallback = operation(_fallback, other._fallback);
+
+    return CapturePredicate(std::move(words), fallback);
 }
 
 }  // namespace unf
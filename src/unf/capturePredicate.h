@@ -6,7 +6,9 @@
 #include "unf/api.h"
 #include "unf/notice.h"
 
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <string>
 #include <vector>
 
@@ -23,6 +25,12 @@ using CapturePredicateFunc = std::function<bool(const UnfNotice::StageNotice&)>;
 ///
 /// Common predicates are provided as static methods for convenience.
 ///
+/// Predicates which only depend on notice types (such as Default, BlockAll,
+/// IncludeTypes and ExcludeTypes) are represented as a set of interned type
+/// keys, so that they are evaluated by testing a single bit without invoking
+/// a function. Combining such predicates with the \c &, \c | and \c ~
+/// operators keeps this representation.
+///
 /// \note
 /// We used a functor embedding a CapturePredicateFunc instead of defining
 /// common predicates via free functions to simplify the Python binding process.
@@ -36,22 +44,126 @@ class CapturePredicate {
     ///
     /// \code{.cpp}
     /// CapturePredicate([&](const unf::UnfNotice::StageNotice& n) {
-    ///     return (n.GetTypeId() != typeid(Foo).name());
+    ///     return (n.GetTypeKey() != Foo::StaticTypeKey());
     /// });
     /// \endcode
+    ///
+    /// \note
+    /// Prefer IncludeTypes or ExcludeTypes when the predicate only depends
+    /// on notice types.
     UNF_API CapturePredicate(const CapturePredicateFunc&);
 
     /// Invoke boolean predicate on UnfNotice::StageNotice \p notice.
     UNF_API bool operator()(const UnfNotice::StageNotice&) const;
 
+    /// \brief
+    /// Invoke boolean predicate on UnfNotice::StageNotice \p notice with its
+    /// type \p key already retrieved.
+    bool operator()(const UnfNotice::StageNotice& notice, NoticeTypeKey key)
+        const
+    {
+        if (_function) return _function(notice);
+        return _Test(key);
+    }
+
+    /// Indicate whether the predicate only depends on notice types.
+    bool IsTypeBased() const { return !_function; }
+
     /// Create a predicate which return true for each notice type.
     UNF_API static CapturePredicate Default();
 
     /// Create a predicate which return false for each notice type.
     UNF_API static CapturePredicate BlockAll();
 
+    /// \brief
+    /// Create a predicate which only return true for notice types
+    /// corresponding to \p keys.
+    ///
+    /// \note
+    /// Notice types derived from these types are not included.
+    UNF_API static CapturePredicate IncludeTypes(
+        const std::vector<NoticeTypeKey>& keys);
+
+    /// \brief
+    /// Create a predicate which only return true for notice types
+    /// derived from UnfNotice::StageNoticeImpl listed in \p Types.
+    ///
+    /// \code{.cpp}
+    /// auto predicate = CapturePredicate::IncludeTypes<Foo, Bar>();
+    /// \endcode
+    template <class... Types>
+    static CapturePredicate IncludeTypes()
+    {
+        return IncludeTypes({Types::StaticTypeKey()...});
+    }
+
+    /// \brief
+    /// Create a predicate which return false for notice types corresponding
+    /// to \p keys.
+    ///
+    /// \note
+    /// Notice types derived from these types are not excluded.
+    UNF_API static CapturePredicate ExcludeTypes(
+        const std::vector<NoticeTypeKey>& keys);
+
+    /// \brief
+    /// Create a predicate which return false for notice types derived from
+    /// UnfNotice::StageNoticeImpl listed in \p Types.
+    ///
+    /// \code{.cpp}
+    /// auto predicate = CapturePredicate::ExcludeTypes<Foo, Bar>();
+    /// \endcode
+    template <class... Types>
+    static CapturePredicate ExcludeTypes()
+    {
+        return ExcludeTypes({Types::StaticTypeKey()...});
+    }
+
+    /// Create a predicate which return true if both predicates return true.
+    UNF_API CapturePredicate operator&(const CapturePredicate&) const;
+
+    /// Create a predicate which return true if either predicate return true.
+    UNF_API CapturePredicate operator|(const CapturePredicate&) const;
+
+    /// Create a predicate which return the opposite of this predicate.
+    UNF_API CapturePredicate operator~() const;
+
   private:
+    using _Word = std::uint64_t;
+
+    static constexpr size_t _wordSize = 64;
+
+    CapturePredicate(std::vector<_Word> words, bool fallback);
+
+    /// Return value for notice type \p key.
+    bool _Test(NoticeTypeKey key) const
+    {
+        const size_t index = key / _wordSize;
+        if (index >= _words.size()) return _fallback;
+        return (_words[index] >> (key % _wordSize)) & 1;
+    }
+
+    /// Return word at \p index, extended with fallback value.
+    _Word _GetWord(size_t index) const
+    {
+        if (index < _words.size()) return _words[index];
+        return _fallback ? ~_Word(0) : _Word(0);
+    }
+
+    /// Create set from \p keys, with all other types set to \p fallback.
+    static CapturePredicate _FromKeys(
+        const std::vector<NoticeTypeKey>& keys, bool fallback);
+
+    /// Combine bit sets of type based predicates with \p operation.
+    template <class Operation>
+    CapturePredicate _Combine(
+        const CapturePredicate& other, Operation operation) const;
+
     CapturePredicateFunc _function = nullptr;
+
+    /// Values for each type key, and value for keys outside of the set.
+    std::vector<_Word> _words;
+    bool _fallback = true;
 };
 
 }  // namespace unf
@@ -0,0 +1,101 @@
+#include "unf/debouncer.h"
+#include "unf/broker.h"
+#include "unf/capturePredicate.h"
+#include "unf/notice.h"
+
+#include <pxr/pxr.h>
+
+#include <chrono>
+#include <mutex>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace unf {
+
+Broker::_Debouncer::_Debouncer(
+    std::chrono::milliseconds quietPeriod,
+    std::chrono::milliseconds maxLatency,
+    const ClockFunc& clock)
+    : _quietPeriod(quietPeriod)
+    , _maxLatency(maxLatency)
+    , _clock(clock)
+    , _merger(CreateMerger())
+{
+    if (!_clock) {
+        _clock = []() { return std::chrono::steady_clock::now(); };
+    }
+}
+
+bool Broker::_Debouncer::Add(
+    const UnfNotice::StageNoticeRefPtr& notice,
+    NoticeTypeKey key,
+    _NoticeMerger& output)
+{
+    const _TimePoint now = _clock();
+    bool flush = false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // If the previous burst is over, its notices are delivered before
+    // starting a new one.
+    if (_pending && now - _last >= _quietPeriod) {
+        _Take(output);
+        flush = true;
+    }
+
+    _merger.Add(notice, key);
+
+    if (!_pending) {
+        _first = now;
+        _pending = true;
+    }
+    _last = now;
+
+    if (now - _first >= _maxLatency) {
+        _Take(output);
+        flush = true;
+    }
+
+    return flush;
+}
+
+bool Broker::_Debouncer::Poll(_NoticeMerger& output)
+{
+    const _TimePoint now = _clock();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_pending
+        || (now - _last < _quietPeriod && now - _first < _maxLatency)) {
+        return false;
+    }
+
+    _Take(output);
+    return true;
+}
+
+bool Broker::_Debouncer::Take(_NoticeMerger& output)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_pending) {
+        return false;
+    }
+
+    _Take(output);
+    return true;
+}
+
+Broker::_NoticeMerger Broker::_Debouncer::CreateMerger()
+{
+    return _NoticeMerger(CapturePredicate::Default(), true);
+}
+
+void Broker::_Debouncer::_Take(_NoticeMerger& output)
+{
+    output.Join(_merger);
+    _merger = CreateMerger();
+    _pending = false;
+}
+
+}  // namespace unf
@@ -0,0 +1,78 @@
+#ifndef USD_NOTICE_FRAMEWORK_DEBOUNCER_H
+#define USD_NOTICE_FRAMEWORK_DEBOUNCER_H
+
+/// \file unf/debouncer.h
+
+#include "unf/broker.h"
+#include "unf/notice.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace unf {
+
+/// \class Broker::_Debouncer
+///
+/// \brief
+/// Collect notices into an implicit transaction which is ended once no
+/// notices have been added for a quiet period, or once a maximum latency
+/// has elapsed since the first notice was added.
+///
+/// Notices can be added from multiple threads. Collected notices are moved
+/// into an output merger so that they can be delivered outside of the lock.
+class Broker::_Debouncer {
+  public:
+    /// Create debouncer measuring time with \p clock, or with the steady
+    /// clock if null.
+    _Debouncer(
+        std::chrono::milliseconds quietPeriod,
+        std::chrono::milliseconds maxLatency,
+        const ClockFunc& clock);
+
+    /// \brief
+    /// Add \p notice with type \p key, and move collected notices into
+    /// \p output if they must be delivered.
+    ///
+    /// Return whether notices have been moved.
+    bool Add(
+        const UnfNotice::StageNoticeRefPtr& notice,
+        NoticeTypeKey key,
+        _NoticeMerger& output);
+
+    /// \brief
+    /// Move collected notices into \p output if the quiet period or the
+    /// maximum latency has elapsed.
+    ///
+    /// Return whether notices have been moved.
+    bool Poll(_NoticeMerger& output);
+
+    /// \brief
+    /// Move collected notices into \p output.
+    ///
+    /// Return whether notices have been moved.
+    bool Take(_NoticeMerger& output);
+
+    /// Create merger folding notices as soon as they are captured, so that
+    /// memory usage is bounded during long bursts.
+    static _NoticeMerger CreateMerger();
+
+  private:
+    using _TimePoint = std::chrono::steady_clock::time_point;
+
+    /// Move collected notices into \p output and start a new burst.
+    void _Take(_NoticeMerger& output);
+
+    std::chrono::milliseconds _quietPeriod;
+    std::chrono::milliseconds _maxLatency;
+    ClockFunc _clock;
+
+    std::mutex _mutex;
+    _NoticeMerger _merger;
+    _TimePoint _first;
+    _TimePoint _last;
+    bool _pending = false;
+};
+
+}  // namespace unf
+
+#endif  // USD_NOTICE_FRAMEWORK_DEBOUNCER_H
@@ -0,0 +1,110 @@
+#include "unf/deliveryQueue.h"
+#include "unf/broker.h"
+#include "unf/notice.h"
+
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/common.h>
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace unf {
+
+Broker::_DeliveryQueue::_DeliveryQueue(const UsdStageWeakPtr& stage)
+    : _state(std::make_shared<_State>())
+{
+    _state->stage = stage;
+    _thread = std::thread(&_DeliveryQueue::_Run, _state);
+}
+
+Broker::_DeliveryQueue::~_DeliveryQueue()
+{
+    if (!_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->stopping = true;
+    }
+    _state->condition.notify_all();
+
+    if (IsDeliveryThread()) {
+        _thread.detach();
+    }
+    else {
+        _thread.join();
+    }
+}
+
+void Broker::_DeliveryQueue::Push(const UnfNotice::StageNoticeRefPtr& notice)
+{
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->notices.push_back(notice);
+    }
+    _state->condition.notify_all();
+}
+
+void Broker::_DeliveryQueue::Discard()
+{
+    std::deque<UnfNotice::StageNoticeRefPtr> notices;
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        notices.swap(_state->notices);
+        _state->stopping = true;
+    }
+    _state->condition.notify_all();
+
+    if (_thread.joinable()) {
+        _thread.detach();
+    }
+}
+
+void Broker::_DeliveryQueue::Wait()
+{
+    if (IsDeliveryThread() || !_thread.joinable()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(_state->mutex);
+    _state->condition.wait(lock, [&]() {
+        return _state->notices.empty() && !_state->delivering;
+    });
+}
+
+void Broker::_DeliveryQueue::_Run(std::shared_ptr<_State> state)
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+
+    while (true) {
+        state->condition.wait(lock, [&]() {
+            return !state->notices.empty() || state->stopping;
+        });
+
+        // Pending notices are delivered before stopping.
+        if (state->notices.empty()) {
+            break;
+        }
+
+        UnfNotice::StageNoticeRefPtr notice =
+            std::move(state->notices.front());
+        state->notices.pop_front();
+        state->delivering = true;
+
+        lock.unlock();
+        notice->Send(state->stage);
+        notice.Reset();
+        lock.lock();
+
+        state->delivering = false;
+        state->condition.notify_all();
+    }
+}
+
+}  // namespace unf
@@ -0,0 +1,78 @@
+#ifndef USD_NOTICE_FRAMEWORK_DELIVERY_QUEUE_H
+#define USD_NOTICE_FRAMEWORK_DELIVERY_QUEUE_H
+
+/// \file unf/deliveryQueue.h
+
+#include "unf/broker.h"
+#include "unf/notice.h"
+
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/common.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace unf {
+
+/// \class Broker::_DeliveryQueue
+///
+/// \brief
+/// Deliver notices from a dedicated thread in the order in which they have
+/// been queued.
+///
+/// The queue state is shared with the thread so that the queue can be
+/// destroyed from a listener invoked on the delivery thread, in which case
+/// the thread is detached and stops once pending notices are delivered.
+/// Discarded queues also detach the thread, which stops once the notice
+/// being delivered, if any, has been delivered.
+class Broker::_DeliveryQueue {
+  public:
+    /// Start thread delivering notices for \p stage.
+    _DeliveryQueue(const PXR_NS::UsdStageWeakPtr& stage);
+
+    /// Stop thread once pending notices have been delivered.
+    ~_DeliveryQueue();
+
+    /// Indicate whether the calling thread is the delivery thread.
+    bool IsDeliveryThread() const
+    {
+        return std::this_thread::get_id() == _thread.get_id();
+    }
+
+    /// Queue \p notice to be delivered.
+    void Push(const UnfNotice::StageNoticeRefPtr& notice);
+
+    /// \brief
+    /// Drop pending notices and stop the thread.
+    ///
+    /// The notice being delivered, if any, is not waited for, as the
+    /// listener might wait for a lock held by the calling thread.
+    void Discard();
+
+    /// Wait until all queued notices have been delivered.
+    void Wait();
+
+  private:
+    /// State shared with the delivery thread.
+    struct _State {
+        PXR_NS::UsdStageWeakPtr stage;
+        std::deque<UnfNotice::StageNoticeRefPtr> notices;
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool delivering = false;
+        bool stopping = false;
+    };
+
+    /// Deliver notices queued in \p state until stopped.
+    static void _Run(std::shared_ptr<_State> state);
+
+    std::shared_ptr<_State> _state;
+    std::thread _thread;
+};
+
+}  // namespace unf
+
+#endif  // USD_NOTICE_FRAMEWORK_DELIVERY_QUEUE_H
@@ -10,6 +10,7 @@
 #include <pxr/base/tf/refPtr.h>
 #include <pxr/base/tf/type.h>
 #include <pxr/base/tf/weakBase.h>
+#include <pxr/base/trace/trace.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/common.h>
 
@@ -81,6 +82,9 @@ class Dispatcher : public PXR_NS::TfRefBase, public PXR_NS::TfWeakBase {
     template <class InputNotice, class OutputNotice>
     void _OnReceiving(const InputNotice& notice)
     {
+        // Function name is labelled with input and output notice types.
+        TRACE_FUNCTION();
+
         PXR_NS::TfRefPtr<OutputNotice> _notice = OutputNotice::Create(notice);
         _broker->Send(_notice);
     }
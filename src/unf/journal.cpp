@@ -0,0 +1,193 @@
+#include "unf/journal.h"
+#include "unf/notice.h"
+#include "unf/serialization.h"
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/pxr.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace unf {
+
+namespace {
+
+// Header identifying journal files, followed by the format version.
+constexpr char JournalHeader[] = "UNFJ\x01";
+constexpr size_t JournalHeaderSize = sizeof(JournalHeader) - 1;
+
+// Size of buffered entries above which they are written to the file.
+constexpr size_t JournalBufferSize = 64 * 1024;
+
+// Map file at filePath, or return a null mapping.
+ArchConstFileMapping MapFile(const std::string& filePath)
+{
+    std::string error;
+    ArchConstFileMapping mapping = ArchMapFileReadOnly(filePath, &error);
+
+    if (!mapping) {
+        TF_RUNTIME_ERROR(
+            "Failed to map journal file: %s (%s)",
+            filePath.c_str(),
+            error.c_str());
+    }
+
+    return mapping;
+}
+
+// Indicate whether mapping starts with journal header.
+bool HasHeader(const ArchConstFileMapping& mapping)
+{
+    if (!mapping) {
+        return false;
+    }
+
+    if (ArchGetFileMappingLength(mapping) < JournalHeaderSize
+        || std::memcmp(mapping.get(), JournalHeader, JournalHeaderSize) != 0) {
+        TF_RUNTIME_ERROR("Failed to read journal file: invalid header.");
+        return false;
+    }
+
+    return true;
+}
+
+}  // anonymous namespace
+
+JournalWriter::JournalWriter(const std::string& filePath)
+    : _file(ArchOpenFile(filePath.c_str(), "wb")),
+      _origin(std::chrono::steady_clock::now())
+{
+    if (!_file) {
+        TF_RUNTIME_ERROR(
+            "Failed to create journal file: %s", filePath.c_str());
+        return;
+    }
+
+    fwrite(JournalHeader, 1, JournalHeaderSize, _file);
+}
+
+JournalWriter::~JournalWriter()
+{
+    if (_file) {
+        _Flush();
+        fclose(_file);
+    }
+}
+
+bool JournalWriter::AddNotice(const UnfNotice::StageNotice& notice)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!CanSerializeNotice(notice)) {
+        _skipped++;
+        return false;
+    }
+
+    _AddEntry(JournalEntryType::Notice);
+    SerializeNotice(notice, _writer);
+
+    if (_writer.GetData().size() > JournalBufferSize) {
+        _Flush();
+    }
+
+    return true;
+}
+
+void JournalWriter::AddBeginTransaction()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _AddEntry(JournalEntryType::BeginTransaction);
+}
+
+void JournalWriter::AddEndTransaction()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _AddEntry(JournalEntryType::EndTransaction);
+    _Flush();
+}
+
+void JournalWriter::Flush()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _Flush();
+}
+
+size_t JournalWriter::GetSkippedCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _skipped;
+}
+
+void JournalWriter::_AddEntry(JournalEntryType type)
+{
+    // Time is recorded as the duration since the previous entry so that it
+    // can be encoded on a few bytes.
+    const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - _origin);
+    const auto delta = time - _time;
+    _time = time;
+
+    _writer.WriteVarint(static_cast<uint64_t>(type));
+    _writer.WriteVarint(static_cast<uint64_t>(delta.count()));
+}
+
+void JournalWriter::_Flush()
+{
+    if (!_file) {
+        return;
+    }
+
+    const std::string data = _writer.TakeData();
+    fwrite(data.data(), 1, data.size(), _file);
+    fflush(_file);
+}
+
+JournalReader::JournalReader(const std::string& filePath)
+    : _mapping(MapFile(filePath)),
+      _valid(HasHeader(_mapping)),
+      _reader(
+          _valid ? _mapping.get() + JournalHeaderSize : nullptr,
+          _valid ? ArchGetFileMappingLength(_mapping) - JournalHeaderSize : 0)
+{
+}
+
+bool JournalReader::Read(JournalEntry& entry)
+{
+    if (!IsValid() || _reader.AtEnd()) {
+        return false;
+    }
+
+    const uint64_t type = _reader.ReadVarint();
+    _time += std::chrono::nanoseconds(_reader.ReadVarint());
+
+    if (type > static_cast<uint64_t>(JournalEntryType::EndTransaction)) {
+        TF_RUNTIME_ERROR("Failed to read journal file: unknown entry.");
+        _valid = false;
+        return false;
+    }
+
+    entry.type = static_cast<JournalEntryType>(type);
+    entry.time = _time;
+    entry.notice = UnfNotice::StageNoticeRefPtr();
+
+    if (entry.type == JournalEntryType::Notice) {
+        entry.notice = DeserializeNotice(_reader);
+
+        // Notices with unknown types cannot be skipped as they might define
+        // entries of the tables shared by subsequent notices.
+        if (!entry.notice) {
+            _valid = false;
+        }
+    }
+
+    return IsValid();
+}
+
+}  // namespace unf
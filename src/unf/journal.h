@@ -0,0 +1,150 @@
+#ifndef USD_NOTICE_FRAMEWORK_JOURNAL_H
+#define USD_NOTICE_FRAMEWORK_JOURNAL_H
+
+/// \file unf/journal.h
+
+#include "unf/api.h"
+#include "unf/notice.h"
+#include "unf/serialization.h"
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/pxr.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+namespace unf {
+
+/// \brief
+/// Indicate the kind of entry recorded in a journal.
+enum class JournalEntryType {
+    /// Notice sent or emitted.
+    Notice,
+
+    /// Beginning of a transaction.
+    BeginTransaction,
+
+    /// End of a transaction.
+    EndTransaction
+};
+
+/// \brief
+/// Entry read from a journal.
+struct JournalEntry {
+    /// Kind of entry.
+    JournalEntryType type = JournalEntryType::Notice;
+
+    /// Time elapsed since the beginning of the journal.
+    std::chrono::nanoseconds time{0};
+
+    /// Notice recorded, or a null pointer for transaction entries.
+    UnfNotice::StageNoticeRefPtr notice;
+};
+
+/// \class JournalWriter
+///
+/// \brief
+/// Append timestamped notices and transaction boundaries to a journal file.
+///
+/// Notices are encoded with a single NoticeWriter so that paths, tokens and
+/// strings are only written once per journal. Only notice types which
+/// support serialization are recorded.
+///
+/// Entries are buffered and written to the file when the end of a
+/// transaction is recorded, when the buffer exceeds a few kilobytes, when
+/// Flush is called or when the writer is destroyed.
+///
+/// \note
+/// Entries can be appended from several threads.
+///
+/// \sa JournalReader
+class JournalWriter {
+  public:
+    /// Create journal file at \p filePath, replacing any existing file.
+    UNF_API JournalWriter(const std::string& filePath);
+
+    UNF_API ~JournalWriter();
+
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+
+    /// Indicate whether the file could be created.
+    bool IsValid() const { return _file != nullptr; }
+
+    /// \brief
+    /// Append \p notice to the journal.
+    ///
+    /// Return false if the notice type does not support serialization.
+    UNF_API bool AddNotice(const UnfNotice::StageNotice& notice);
+
+    /// Append beginning of a transaction to the journal.
+    UNF_API void AddBeginTransaction();
+
+    /// Append end of a transaction to the journal.
+    UNF_API void AddEndTransaction();
+
+    /// Write all buffered entries to the file.
+    UNF_API void Flush();
+
+    /// Return number of notices which could not be recorded.
+    UNF_API size_t GetSkippedCount() const;
+
+  private:
+    /// Append header of entry with \p type to the buffer.
+    void _AddEntry(JournalEntryType type);
+
+    /// Write buffered entries to the file.
+    void _Flush();
+
+    FILE* _file;
+    std::chrono::steady_clock::time_point _origin;
+    std::chrono::nanoseconds _time{0};
+
+    NoticeWriter _writer;
+    size_t _skipped = 0;
+
+    mutable std::mutex _mutex;
+};
+
+/// \class JournalReader
+///
+/// \brief
+/// Read entries from a journal file written by a JournalWriter.
+///
+/// The file is memory-mapped and decoded progressively.
+///
+/// \sa JournalWriter
+class JournalReader {
+  public:
+    /// Open journal file at \p filePath.
+    UNF_API JournalReader(const std::string& filePath);
+
+    JournalReader(const JournalReader&) = delete;
+    JournalReader& operator=(const JournalReader&) = delete;
+
+    /// \brief
+    /// Indicate whether the file could be opened and entries read so far
+    /// could be decoded.
+    bool IsValid() const { return _valid && _reader.IsValid(); }
+
+    /// \brief
+    /// Read next entry into \p entry.
+    ///
+    /// Return false when all entries have been read or if the journal is
+    /// invalid.
+    UNF_API bool Read(JournalEntry& entry);
+
+  private:
+    PXR_NS::ArchConstFileMapping _mapping;
+    bool _valid;
+
+    NoticeReader _reader;
+    std::chrono::nanoseconds _time{0};
+};
+
+}  // namespace unf
+
+#endif  // USD_NOTICE_FRAMEWORK_JOURNAL_H
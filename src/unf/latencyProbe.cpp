@@ -0,0 +1,211 @@
+#include "unf/latencyProbe.h"
+#include "unf/broker.h"
+#include "unf/notice.h"
+
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/common.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace unf {
+
+Broker::_LatencyProbe::_LatencyProbe(const UsdStageWeakPtr& stage)
+    : _sender(get_pointer(stage))
+{
+}
+
+Broker::_LatencyProbe::~_LatencyProbe() { Disable(); }
+
+void Broker::_LatencyProbe::Enable()
+{
+    if (!_enabled) {
+        TfNotice::InsertProbe(TfCreateWeakPtr(this));
+        _enabled = true;
+    }
+}
+
+void Broker::_LatencyProbe::Disable()
+{
+    if (_enabled) {
+        TfNotice::RemoveProbe(TfCreateWeakPtr(this));
+        _enabled = false;
+    }
+}
+
+void Broker::_LatencyProbe::BeginSend(
+    const TfNotice& notice, const TfWeakBase* sender, const std::type_info&)
+{
+    _Frame frame;
+
+    if (sender && sender == _sender) {
+        auto _notice = dynamic_cast<const UnfNotice::StageNotice*>(&notice);
+        if (_notice) {
+            frame.key = _notice->GetTypeKey();
+            frame.tracked = true;
+        }
+    }
+
+    _Push(frame);
+}
+
+void Broker::_LatencyProbe::EndSend() { _Pop(); }
+
+void Broker::_LatencyProbe::BeginDelivery(
+    const TfNotice&,
+    const TfWeakBase*,
+    const std::type_info&,
+    const TfWeakBase*,
+    const std::type_info& listenerType)
+{
+    _Frame frame;
+
+    // Deliveries are measured if the enclosing send is measured.
+    auto& frames = _frames.local();
+    if (!frames.empty() && frames.back().tracked) {
+        frame.key = frames.back().key;
+        frame.listener = std::type_index(listenerType);
+        frame.tracked = true;
+    }
+
+    _Push(frame);
+}
+
+void Broker::_LatencyProbe::EndDelivery() { _Pop(); }
+
+void Broker::_LatencyProbe::Fill(BrokerStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto& element : _histograms) {
+        LatencyStatistics latency;
+        latency.typeName =
+            UnfNotice::StageNotice::GetTypeKeyName(element.first.first);
+
+        if (element.first.second != std::type_index(typeid(void))) {
+            latency.listenerName =
+                ArchGetDemangled(element.first.second.name());
+        }
+
+        element.second.Fill(latency);
+        statistics.latencies.push_back(std::move(latency));
+    }
+}
+
+void Broker::_LatencyProbe::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _histograms.clear();
+}
+
+void Broker::_LatencyProbe::_Push(_Frame& frame)
+{
+    if (frame.tracked) {
+        frame.start = _Clock::now();
+    }
+
+    _frames.local().push_back(frame);
+}
+
+void Broker::_LatencyProbe::_Pop()
+{
+    const _Clock::time_point end = _Clock::now();
+
+    auto& frames = _frames.local();
+    if (frames.empty()) {
+        return;
+    }
+
+    const _Frame frame = frames.back();
+    frames.pop_back();
+
+    if (!frame.tracked) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _histograms[_HistogramKey(frame.key, frame.listener)].Add(
+        end - frame.start);
+}
+
+void Broker::_LatencyProbe::_Histogram::Add(std::chrono::nanoseconds duration)
+{
+    const uint64_t value =
+        static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+
+    _buckets[_GetBucket(value)]++;
+    _max = std::max(_max, value);
+    _count++;
+}
+
+void Broker::_LatencyProbe::_Histogram::Fill(
+    LatencyStatistics& statistics) const
+{
+    statistics.count = _count;
+    statistics.p50 = std::chrono::nanoseconds(_GetPercentile(0.5));
+    statistics.p99 = std::chrono::nanoseconds(_GetPercentile(0.99));
+    statistics.max = std::chrono::nanoseconds(_max);
+}
+
+size_t Broker::_LatencyProbe::_Histogram::_GetBucket(uint64_t value)
+{
+    // Values below four are attributed to their own bucket, larger values
+    // to one of four buckets subdividing their power of two.
+    if (value < 4) {
+        return static_cast<size_t>(value);
+    }
+
+    size_t exponent = 0;
+    for (uint64_t v = value; v > 1; v >>= 1) {
+        exponent++;
+    }
+
+    return 4 * (exponent - 1) + ((value >> (exponent - 2)) & 3);
+}
+
+uint64_t Broker::_LatencyProbe::_Histogram::_GetUpperBound(size_t bucket)
+{
+    if (bucket < 4) {
+        return bucket;
+    }
+
+    const size_t shift = bucket / 4 - 1;
+    const uint64_t lower = static_cast<uint64_t>(4 + bucket % 4) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+uint64_t Broker::_LatencyProbe::_Histogram::_GetPercentile(
+    double percentile) const
+{
+    if (_count == 0) {
+        return 0;
+    }
+
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(percentile * _count)));
+
+    // Upper bound of the bucket containing the percentile is never greater
+    // than the maximum duration recorded.
+    uint64_t total = 0;
+    for (size_t bucket = 0; bucket < _bucketCount; ++bucket) {
+        total += _buckets[bucket];
+        if (total >= rank) {
+            return std::min(_GetUpperBound(bucket), _max);
+        }
+    }
+
+    return _max;
+}
+
+}  // namespace unf
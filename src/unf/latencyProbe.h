@@ -0,0 +1,143 @@
+#ifndef USD_NOTICE_FRAMEWORK_LATENCY_PROBE_H
+#define USD_NOTICE_FRAMEWORK_LATENCY_PROBE_H
+
+/// \file unf/latencyProbe.h
+
+#include "unf/broker.h"
+#include "unf/notice.h"
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/common.h>
+#include <tbb/enumerable_thread_specific.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace unf {
+
+/// \class Broker::_LatencyProbe
+///
+/// \brief
+/// Record the time spent delivering notices sent for a stage, and the time
+/// spent in each listener invoked.
+///
+/// The probe is invoked for every notice sent within the process, from any
+/// thread, and sends can be nested when listeners send notices themselves.
+/// Each thread therefore records a stack of pending sends and deliveries,
+/// which are only measured when the notice is derived from
+/// UnfNotice::StageNotice and is sent for the stage.
+class Broker::_LatencyProbe : public PXR_NS::TfNotice::Probe {
+  public:
+    /// Create probe measuring notices sent for \p stage.
+    _LatencyProbe(const PXR_NS::UsdStageWeakPtr& stage);
+
+    virtual ~_LatencyProbe() override;
+
+    /// Start receiving notices sent within the process.
+    void Enable();
+
+    /// Stop receiving notices sent within the process.
+    void Disable();
+
+    /// Indicate whether notices sent within the process are received.
+    bool IsEnabled() const { return _enabled; }
+
+    virtual void BeginSend(
+        const PXR_NS::TfNotice& notice,
+        const PXR_NS::TfWeakBase* sender,
+        const std::type_info& senderType) override;
+
+    virtual void EndSend() override;
+
+    virtual void BeginDelivery(
+        const PXR_NS::TfNotice& notice,
+        const PXR_NS::TfWeakBase* sender,
+        const std::type_info& senderType,
+        const PXR_NS::TfWeakBase* listener,
+        const std::type_info& listenerType) override;
+
+    virtual void EndDelivery() override;
+
+    /// Append latencies recorded for each notice type and each listener to
+    /// \p statistics.
+    void Fill(BrokerStatistics& statistics) const;
+
+    /// Remove all latencies recorded.
+    void Reset();
+
+  private:
+    using _Clock = std::chrono::steady_clock;
+
+    /// \brief
+    /// Count durations in buckets growing exponentially.
+    ///
+    /// Each power of two is divided into four buckets, so that percentiles
+    /// are approximated within 25% of the recorded durations with a fixed
+    /// memory footprint.
+    class _Histogram {
+      public:
+        /// Record \p duration.
+        void Add(std::chrono::nanoseconds duration);
+
+        /// Set count, percentiles and maximum duration of \p statistics.
+        void Fill(LatencyStatistics& statistics) const;
+
+      private:
+        static constexpr size_t _bucketCount = 252;
+
+        /// Return bucket containing \p value.
+        static size_t _GetBucket(uint64_t value);
+
+        /// Return largest value contained in \p bucket.
+        static uint64_t _GetUpperBound(size_t bucket);
+
+        /// Return approximated \p percentile of the recorded durations.
+        uint64_t _GetPercentile(double percentile) const;
+
+        std::array<uint64_t, _bucketCount> _buckets{};
+        uint64_t _count = 0;
+        uint64_t _max = 0;
+    };
+
+    /// Histograms are identified by notice type key and listener type. The
+    /// void type identifies the delivery of notices to all listeners.
+    using _HistogramKey = std::pair<NoticeTypeKey, std::type_index>;
+
+    /// Pending send or delivery on a thread.
+    struct _Frame {
+        NoticeTypeKey key = 0;
+        std::type_index listener = std::type_index(typeid(void));
+        bool tracked = false;
+        _Clock::time_point start;
+    };
+
+    /// Start measuring \p frame if it is tracked.
+    void _Push(_Frame& frame);
+
+    /// Record duration of the last frame if it is tracked.
+    void _Pop();
+
+    /// Stage used as sender, which is only compared by address.
+    const PXR_NS::TfWeakBase* _sender;
+
+    bool _enabled = false;
+
+    tbb::enumerable_thread_specific<std::vector<_Frame> > _frames;
+
+    mutable std::mutex _mutex;
+    std::map<_HistogramKey, _Histogram> _histograms;
+};
+
+}  // namespace unf
+
+#endif  // USD_NOTICE_FRAMEWORK_LATENCY_PROBE_H
@@ -1,11 +1,22 @@
 #include "unf/notice.h"
+#include "unf/serialization.h"
 
+#include <pxr/base/arch/demangle.h>
 #include <pxr/base/tf/notice.h>
+#include <pxr/base/trace/trace.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/notice.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -13,22 +24,102 @@ namespace unf {
 
 namespace UnfNotice {
 
+namespace {
+
+// Indicate whether the path or one of its ancestors is in the set. Parent
+// paths are walked up to the absolute root path without allocation, so the
+// cost is bounded by the number of elements in the path.
+bool _HasPrefixInSet(const SdfPathSet& paths, const SdfPath& path)
+{
+    if (paths.empty()) return false;
+
+    for (SdfPath prefix = path; !prefix.IsEmpty();
+         prefix = prefix.GetParentPath()) {
+        if (paths.find(prefix) != paths.end()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Record key interned for each notice type, and name of each type indexed
+// by key.
+struct TypeKeyRegistry {
+    static TypeKeyRegistry& GetInstance()
+    {
+        static TypeKeyRegistry registry;
+        return registry;
+    }
+
+    std::mutex mutex;
+    std::unordered_map<std::type_index, NoticeTypeKey> keys;
+    std::vector<std::string> names;
+};
+
+}  // anonymous namespace
+
 TF_REGISTRY_FUNCTION(TfType)
 {
     TfType::Define<StageNotice, TfType::Bases<TfNotice> >();
 
-    TfType::Define<StageContentsChanged, TfType::Bases<StageNotice> >();
-    TfType::Define<StageEditTargetChanged, TfType::Bases<StageNotice> >();
-    TfType::Define<ObjectsChanged, TfType::Bases<StageNotice> >();
-    TfType::Define<LayerMutingChanged, TfType::Bases<StageNotice> >();
+    NoticeSerializerDefine<StageContentsChanged, StageNotice>();
+    NoticeSerializerDefine<StageEditTargetChanged, StageNotice>();
+    NoticeSerializerDefine<ObjectsChanged, StageNotice>();
+    NoticeSerializerDefine<LayerMutingChanged, StageNotice>();
+}
+
+NoticeTypeKey StageNotice::InternTypeKey(const std::type_info& typeInfo)
+{
+    TypeKeyRegistry& registry = TypeKeyRegistry::GetInstance();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Attribute next available key to types which are not registered yet.
+    auto result =
+        registry.keys.emplace(std::type_index(typeInfo), registry.keys.size());
+
+    if (result.second) {
+        registry.names.push_back(ArchGetDemangled(typeInfo));
+    }
+
+    return result.first->second;
+}
+
+std::string StageNotice::GetTypeKeyName(NoticeTypeKey key)
+{
+    TypeKeyRegistry& registry = TypeKeyRegistry::GetInstance();
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    if (key >= registry.names.size()) {
+        return std::string();
+    }
+
+    return registry.names[key];
+}
+
+TfRefPtr<StageContentsChanged> StageContentsChanged::Deserialize(
+    NoticeReader&)
+{
+    return Create();
+}
+
+TfRefPtr<StageEditTargetChanged> StageEditTargetChanged::Deserialize(
+    NoticeReader&)
+{
+    return Create();
 }
 
 ObjectsChanged::ObjectsChanged(const UsdNotice::ObjectsChanged& notice)
 {
+    TRACE_FUNCTION();
+
     // TODO: Update Usd Notice to give easier access to fields.
 
     for (const auto& path : notice.GetResyncedPaths()) {
         _resyncChanges.push_back(path);
+        _resyncIndex.insert(path);
 
         auto tokens = notice.GetChangedFields(path);
         if (tokens.size() > 0) {
@@ -37,6 +128,7 @@ ObjectsChanged::ObjectsChanged(const UsdNotice::ObjectsChanged& notice)
     }
     for (const auto& path : notice.GetChangedInfoOnlyPaths()) {
         _infoChanges.push_back(path);
+        _infoIndex.insert(path);
 
         auto tokens = notice.GetChangedFields(path);
         if (tokens.size() > 0) {
@@ -48,7 +140,9 @@ ObjectsChanged::ObjectsChanged(const UsdNotice::ObjectsChanged& notice)
 ObjectsChanged::ObjectsChanged(const ObjectsChanged& other)
     : _resyncChanges(other._resyncChanges),
       _infoChanges(other._infoChanges),
-      _changedFields(other._changedFields)
+      _changedFields(other._changedFields),
+      _resyncIndex(other._resyncIndex),
+      _infoIndex(other._infoIndex)
 {
 }
 
@@ -58,80 +152,114 @@ ObjectsChanged& ObjectsChanged::operator=(const ObjectsChanged& other)
     std::swap(_resyncChanges, copy._resyncChanges);
     std::swap(_infoChanges, copy._infoChanges);
     std::swap(_changedFields, copy._changedFields);
+    std::swap(_resyncIndex, copy._resyncIndex);
+    std::swap(_infoIndex, copy._infoIndex);
     return *this;
 }
 
 void ObjectsChanged::Merge(ObjectsChanged&& notice)
 {
-    SdfPathSet resyncSet(_resyncChanges.begin(), _resyncChanges.end());
+    TRACE_FUNCTION();
 
     // Update resyncChanges if necessary.
-    for (const auto& path : notice._resyncChanges) {
-        if (resyncSet.find(path) == resyncSet.end()) {
-            resyncSet.insert(path);
+    for (auto& path : notice._resyncChanges) {
+        if (_resyncIndex.insert(path).second) {
             _resyncChanges.push_back(std::move(path));
         }
     }
 
     // Update infoChanges if necessary.
-    for (const auto& path : notice._infoChanges) {
-        const SdfPath& primPath = path.GetPrimPath();
-
-        // Skip if the path is already in resyncedPaths.
-        if (resyncSet.find(primPath) != resyncSet.end()) {
-            continue;
-        }
-
-        // Skip if an ancestor of the path is already in resyncedPaths.
-        bool ancestorResynced = false;
-        for (const auto& ancestor : primPath.GetPrefixes()) {
-            if (resyncSet.find(ancestor) != resyncSet.end()) {
-                ancestorResynced = true;
-                break;
-            }
-        }
-        if (ancestorResynced) {
+    for (auto& path : notice._infoChanges) {
+        // Skip if the path or an ancestor of the path is already in
+        // resyncedPaths.
+        if (_HasPrefixInSet(_resyncIndex, path.GetPrimPath())) {
             continue;
         }
 
-        auto it = std::find(_infoChanges.begin(), _infoChanges.end(), path);
-        if (it == _infoChanges.end()) {
+        if (_infoIndex.insert(path).second) {
             _infoChanges.push_back(std::move(path));
         }
     }
 
     // Update changeFields.
-    for (auto const& entry : notice._changedFields) {
-        auto const path = entry.first;
+    for (auto& entry : notice._changedFields) {
+        auto it = _changedFields.find(entry.first);
 
-        if (_changedFields.find(path) == _changedFields.end()) {
-            _changedFields[path] = std::move(notice._changedFields[path]);
+        if (it == _changedFields.end()) {
+            _changedFields.emplace(entry.first, std::move(entry.second));
         }
         else {
-            _changedFields[path].insert(
-                notice._changedFields[path].begin(),
-                notice._changedFields[path].end());
+            it->second.insert(entry.second.begin(), entry.second.end());
         }
     }
 }
 
 void ObjectsChanged::PostProcess()
 {
+    TRACE_FUNCTION();
+
     SdfPath::RemoveDescendentPaths(&_resyncChanges);
 }
 
+void ObjectsChanged::Serialize(NoticeWriter& writer) const
+{
+    writer.WritePaths(_resyncChanges);
+    writer.WritePaths(_infoChanges);
+
+    writer.WriteVarint(_changedFields.size());
+    for (const auto& entry : _changedFields) {
+        writer.WritePath(entry.first);
+        writer.WriteVarint(entry.second.size());
+        for (const auto& token : entry.second) {
+            writer.WriteToken(token);
+        }
+    }
+}
+
+TfRefPtr<ObjectsChanged> ObjectsChanged::Deserialize(NoticeReader& reader)
+{
+    auto notice = Create();
+
+    // Indexes are not encoded as they can be rebuilt from the paths.
+    notice->_resyncChanges = reader.ReadPaths();
+    notice->_resyncIndex.insert(
+        notice->_resyncChanges.begin(), notice->_resyncChanges.end());
+
+    notice->_infoChanges = reader.ReadPaths();
+    notice->_infoIndex.insert(
+        notice->_infoChanges.begin(), notice->_infoChanges.end());
+
+    const uint64_t size = reader.ReadVarint();
+    for (uint64_t i = 0; i < size && reader.IsValid(); ++i) {
+        TfTokenSet& tokens = notice->_changedFields[reader.ReadPath()];
+
+        const uint64_t tokenSize = reader.ReadVarint();
+        for (uint64_t j = 0; j < tokenSize && reader.IsValid(); ++j) {
+            tokens.insert(reader.ReadToken());
+        }
+    }
+
+    return notice;
+}
+
 bool ObjectsChanged::ResyncedObject(const PXR_NS::UsdObject& object) const
 {
-    auto path = PXR_NS::SdfPathFindLongestPrefix(
-        _resyncChanges.begin(), _resyncChanges.end(), object.GetPath());
-    return path != _resyncChanges.end();
+    return ResyncedObject(object.GetPath());
+}
+
+bool ObjectsChanged::ResyncedObject(const PXR_NS::SdfPath& path) const
+{
+    return _HasPrefixInSet(_resyncIndex, path);
 }
 
 bool ObjectsChanged::ChangedInfoOnly(const PXR_NS::UsdObject& object) const
 {
-    auto path = PXR_NS::SdfPathFindLongestPrefix(
-        _infoChanges.begin(), _infoChanges.end(), object.GetPath());
-    return path != _infoChanges.end();
+    return ChangedInfoOnly(object.GetPath());
+}
+
+bool ObjectsChanged::ChangedInfoOnly(const PXR_NS::SdfPath& path) const
+{
+    return _HasPrefixInSet(_infoIndex, path);
 }
 
 TfTokenSet ObjectsChanged::GetChangedFields(
@@ -188,8 +316,25 @@ LayerMutingChanged& LayerMutingChanged::operator=(
     return *this;
 }
 
+void LayerMutingChanged::Serialize(NoticeWriter& writer) const
+{
+    writer.WriteStrings(_mutedLayers);
+    writer.WriteStrings(_unmutedLayers);
+}
+
+TfRefPtr<LayerMutingChanged> LayerMutingChanged::Deserialize(
+    NoticeReader& reader)
+{
+    auto notice = Create();
+    notice->_mutedLayers = reader.ReadStrings();
+    notice->_unmutedLayers = reader.ReadStrings();
+    return notice;
+}
+
 void LayerMutingChanged::Merge(LayerMutingChanged&& notice)
 {
+    TRACE_FUNCTION();
+
     size_t mutedLayersSize = _mutedLayers.size();
     size_t unmutedLayersSize = _unmutedLayers.size();
 
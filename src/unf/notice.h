@@ -13,13 +13,18 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/notice.h>
 
+#include <cstddef>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 namespace unf {
 
+/// Convenient alias for interned notice type key.
+using NoticeTypeKey = std::size_t;
+
 /// Convenient alias for set of tokens.
 using TfTokenSet =
     std::unordered_set<PXR_NS::TfToken, PXR_NS::TfToken::HashFunctor>;
@@ -31,6 +36,9 @@ using SdfPathSet = std::unordered_set<PXR_NS::SdfPath, PXR_NS::SdfPath::Hash>;
 using ChangedFieldMap =
     std::unordered_map<PXR_NS::SdfPath, TfTokenSet, PXR_NS::SdfPath::Hash>;
 
+class NoticeWriter;
+class NoticeReader;
+
 namespace UnfNotice {
 
 /// \class StageNotice
@@ -58,9 +66,28 @@ class StageNotice : public PXR_NS::TfNotice, public PXR_NS::TfRefBase {
     /// \sa NoticeTransaction
     UNF_API virtual bool IsMergeable() const { return true; }
 
+    /// \brief
+    /// Indicate whether notices from the same type can be merged in any
+    /// grouping.
+    ///
+    /// When true, merging a notice with the result of merging two following
+    /// notices must be equivalent, once post-processed, to merging the three
+    /// notices one after the other. Large lists of such notices are then
+    /// merged with a parallel reduction which preserves the capture order.
+    ///
+    /// By default, this method return false.
+    ///
+    /// \sa Merge
+    UNF_API virtual bool IsMergeAssociative() const { return false; }
+
     /// \brief
     /// Interface method for merging StageNotice.
     ///
+    /// \note
+    /// Notices of distinct types might be merged concurrently when a large
+    /// transaction ends, so this method must not modify state shared with
+    /// other notice types.
+    ///
     /// \warning
     /// This method should be considered as pure virtual.
     virtual void Merge(StageNotice&&)
@@ -74,6 +101,10 @@ class StageNotice : public PXR_NS::TfNotice, public PXR_NS::TfRefBase {
     /// transaction.
     ///
     /// By default, no process is done.
+    ///
+    /// \note
+    /// Like Merge, this method might be called concurrently with the
+    /// post-process of notices of other types.
     virtual void PostProcess() {}
 
     /// \brief
@@ -89,6 +120,48 @@ class StageNotice : public PXR_NS::TfNotice, public PXR_NS::TfRefBase {
         return "";
     }
 
+    /// \brief
+    /// Interface method for returning interned type key.
+    ///
+    /// Contrary to GetTypeId, the key is a cheap integer attributed once per
+    /// notice type, which makes it suitable to identify notice types on hot
+    /// paths. Keys are attributed in sequence starting from zero and are only
+    /// stable within the current process.
+    ///
+    /// \warning
+    /// This method should be considered as pure virtual.
+    UNF_API virtual NoticeTypeKey GetTypeKey() const
+    {
+        PXR_NAMESPACE_USING_DIRECTIVE
+        TF_FATAL_ERROR(
+            "Abstract class 'StageNotice' does not have a type key.");
+        return 0;
+    }
+
+    /// \brief
+    /// Return interned type key corresponding to \p typeInfo.
+    ///
+    /// The same key is returned for each call with identical type
+    /// information, including across shared library boundaries.
+    UNF_API static NoticeTypeKey InternTypeKey(const std::type_info& typeInfo);
+
+    /// \brief
+    /// Return demangled name of the type interned with \p key.
+    ///
+    /// An empty string is returned if no type has been interned with
+    /// this key.
+    UNF_API static std::string GetTypeKeyName(NoticeTypeKey key);
+
+    /// \brief
+    /// Base method for encoding notice data into \p writer.
+    ///
+    /// By default, no data is written. Notice types which support
+    /// serialization must override this method and be defined with
+    /// unf::NoticeSerializerDefine.
+    ///
+    /// \sa unf::SerializeNotice
+    virtual void Serialize(NoticeWriter&) const {}
+
     /// \brief
     /// Interface method to return a copy of the notice.
     ///
@@ -180,6 +253,22 @@ class StageNoticeImpl : public StageNotice {
         return PXR_NS::ArchGetDemangled(typeid(Self).name());
     }
 
+    /// \brief
+    /// Return interned type key of the notice type.
+    ///
+    /// The key is only computed once per notice type.
+    static NoticeTypeKey StaticTypeKey()
+    {
+        static const NoticeTypeKey key = InternTypeKey(typeid(Self));
+        return key;
+    }
+
+    /// Return interned type key of the notice type.
+    virtual NoticeTypeKey GetTypeKey() const override
+    {
+        return StaticTypeKey();
+    }
+
   private:
     /// \brief
     /// Return a raw pointer to a copy of the notice.
@@ -205,7 +294,14 @@ class StageContentsChanged : public StageNoticeImpl<StageContentsChanged> {
   public:
     UNF_API virtual ~StageContentsChanged() = default;
 
+    /// Create notice from data encoded by \ref unf::NoticeWriter "writer".
+    UNF_API static PXR_NS::TfRefPtr<StageContentsChanged> Deserialize(
+        NoticeReader&);
+
   protected:
+    /// Create empty notice.
+    StageContentsChanged() = default;
+
     /// Create notice from PXR_NS::UsdNotice::StageContentsChanged instance.
     explicit StageContentsChanged(
         const PXR_NS::UsdNotice::StageContentsChanged&)
@@ -246,6 +342,16 @@ class ObjectsChanged : public StageNoticeImpl<ObjectsChanged> {
     UNF_API virtual void Merge(ObjectsChanged&&) override;
     UNF_API virtual void PostProcess() override;
 
+    /// Indicate that notices can be merged in any grouping.
+    UNF_API virtual bool IsMergeAssociative() const override { return true; }
+
+    /// Encode resynced paths, modified paths and changed fields.
+    UNF_API virtual void Serialize(NoticeWriter&) const override;
+
+    /// Create notice from data encoded by \ref unf::NoticeWriter "writer".
+    UNF_API static PXR_NS::TfRefPtr<ObjectsChanged> Deserialize(
+        NoticeReader&);
+
     /// \brief
     /// Indicate whether \p object was affected by the change that generated
     /// this notice.
@@ -254,25 +360,55 @@ class ObjectsChanged : public StageNoticeImpl<ObjectsChanged> {
     /// Equivalent from PXR_NS::UsdNotice::ObjectsChanged::AffectedObject
     UNF_API bool AffectedObject(const PXR_NS::UsdObject& object) const
     {
-        return ResyncedObject(object) || ChangedInfoOnly(object);
+        return AffectedObject(object.GetPath());
+    }
+
+    /// \brief
+    /// Indicate whether \p path was affected by the change that generated
+    /// this notice.
+    ///
+    /// \sa AffectedObject(const PXR_NS::UsdObject&) const
+    UNF_API bool AffectedObject(const PXR_NS::SdfPath& path) const
+    {
+        return ResyncedObject(path) || ChangedInfoOnly(path);
     }
 
     /// \brief
     /// Indicate whether \p object was resynced by the change that generated
     /// this notice.
     ///
+    /// The query is performed in constant time per element of the object
+    /// path.
+    ///
     /// \note
     /// Equivalent from PXR_NS::UsdNotice::ObjectsChanged::ResyncedObject
     UNF_API bool ResyncedObject(const PXR_NS::UsdObject&) const;
 
+    /// \brief
+    /// Indicate whether \p path was resynced by the change that generated
+    /// this notice.
+    ///
+    /// \sa ResyncedObject(const PXR_NS::UsdObject&) const
+    UNF_API bool ResyncedObject(const PXR_NS::SdfPath&) const;
+
     /// \brief
     /// Indicate whether \p object was modified but not resynced by the change
     /// that generated this notice.
     ///
+    /// The query is performed in constant time per element of the object
+    /// path.
+    ///
     /// \note
     /// Equivalent from PXR_NS::UsdNotice::ObjectsChanged::ChangedInfoOnly
     UNF_API bool ChangedInfoOnly(const PXR_NS::UsdObject&) const;
 
+    /// \brief
+    /// Indicate whether \p path was modified but not resynced by the change
+    /// that generated this notice.
+    ///
+    /// \sa ChangedInfoOnly(const PXR_NS::UsdObject&) const
+    UNF_API bool ChangedInfoOnly(const PXR_NS::SdfPath&) const;
+
     /// \brief
     /// Return vector of paths that are resynced in lexicographical order.
     ///
@@ -336,6 +472,9 @@ class ObjectsChanged : public StageNoticeImpl<ObjectsChanged> {
     const ChangedFieldMap& GetChangedFieldMap() const { return _changedFields; }
 
   protected:
+    /// Create empty notice.
+    ObjectsChanged() = default;
+
     /// Create notice from PXR_NS::UsdNotice::ObjectsChanged instance.
     explicit ObjectsChanged(const PXR_NS::UsdNotice::ObjectsChanged&);
 
@@ -351,6 +490,16 @@ class ObjectsChanged : public StageNoticeImpl<ObjectsChanged> {
 
     /// Map of affected token sets organized per path.
     ChangedFieldMap _changedFields;
+
+    /// \brief
+    /// Set of resynced paths used to merge notices in linear time and to
+    /// query objects in constant time per path element.
+    SdfPathSet _resyncIndex;
+
+    /// \brief
+    /// Set of modified paths used to merge notices in linear time and to
+    /// query objects in constant time per path element.
+    SdfPathSet _infoIndex;
 };
 
 /// \class StageEditTargetChanged
@@ -364,7 +513,14 @@ class StageEditTargetChanged : public StageNoticeImpl<StageEditTargetChanged> {
   public:
     UNF_API virtual ~StageEditTargetChanged() = default;
 
+    /// Create notice from data encoded by \ref unf::NoticeWriter "writer".
+    UNF_API static PXR_NS::TfRefPtr<StageEditTargetChanged> Deserialize(
+        NoticeReader&);
+
   protected:
+    /// Create empty notice.
+    StageEditTargetChanged() = default;
+
     /// Create notice from PXR_NS::UsdNotice::StageEditTargetChanged instance.
     explicit StageEditTargetChanged(
         const PXR_NS::UsdNotice::StageEditTargetChanged&)
@@ -403,6 +559,16 @@ class LayerMutingChanged : public StageNoticeImpl<LayerMutingChanged> {
     /// Data will be move out of incoming LayerMutingChanged notice.
     UNF_API virtual void Merge(LayerMutingChanged&&) override;
 
+    /// Indicate that notices can be merged in any grouping.
+    UNF_API virtual bool IsMergeAssociative() const override { return true; }
+
+    /// Encode identifiers of muted and unmuted layers.
+    UNF_API virtual void Serialize(NoticeWriter&) const override;
+
+    /// Create notice from data encoded by \ref unf::NoticeWriter "writer".
+    UNF_API static PXR_NS::TfRefPtr<LayerMutingChanged> Deserialize(
+        NoticeReader&);
+
     /// \brief
     /// Returns identifiers of the layers that were muted.
     ///
@@ -426,6 +592,9 @@ class LayerMutingChanged : public StageNoticeImpl<LayerMutingChanged> {
     }
 
   protected:
+    /// Create empty notice.
+    LayerMutingChanged() = default;
+
     /// Create notice from PXR_NS::UsdNotice::LayerMutingChanged instance.
     explicit LayerMutingChanged(const PXR_NS::UsdNotice::LayerMutingChanged&);
 
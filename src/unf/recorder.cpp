@@ -0,0 +1,197 @@
+#include "unf/recorder.h"
+#include "unf/broker.h"
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/getenv.h>
+#include <pxr/pxr.h>
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace unf {
+
+Broker::_Recorder::_Recorder(const std::string& filePath)
+    : _filePath(filePath), _stream(filePath), _origin(Now())
+{
+    if (!_stream) {
+        TF_RUNTIME_ERROR(
+            "Failed to write notice trace file: %s", _filePath.c_str());
+        return;
+    }
+
+    _stream << std::fixed << std::setprecision(3);
+    _stream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+}
+
+Broker::_Recorder::~_Recorder()
+{
+    if (_stream) {
+        _stream << "\n]}\n";
+    }
+}
+
+std::shared_ptr<Broker::_Recorder> Broker::_Recorder::GetFromEnvironment()
+{
+    static const std::string filePath = TfGetenv("UNF_TRACE_FILE");
+    if (filePath.empty()) {
+        return nullptr;
+    }
+
+    static std::mutex mutex;
+    static std::weak_ptr<_Recorder> shared;
+    static size_t session = 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::shared_ptr<_Recorder> recorder = shared.lock();
+    if (!recorder) {
+        recorder = std::make_shared<_Recorder>(
+            _GetSessionFilePath(filePath, session++));
+        shared = recorder;
+    }
+
+    return recorder;
+}
+
+size_t Broker::_Recorder::AddProcess(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const size_t process = ++_processCount;
+
+    _stream << (_eventCount++ > 0 ? ",\n" : "\n");
+    _stream << "{\"name\": \"process_name\", \"ph\": \"M\", "
+            << "\"pid\": " << process << ", \"tid\": 0, "
+            << "\"args\": {\"name\": \"" << _Escape(name) << "\"}}";
+
+    return process;
+}
+
+void Broker::_Recorder::Begin(
+    size_t process, const char* name, const char* category)
+{
+    _Add(process, name, category, 'B', Now(), TimePoint(), "");
+}
+
+void Broker::_Recorder::End(
+    size_t process, const char* name, const char* category)
+{
+    _Add(process, name, category, 'E', Now(), TimePoint(), "");
+}
+
+void Broker::_Recorder::Instant(
+    size_t process,
+    const std::string& name,
+    const char* category,
+    const std::string& args)
+{
+    _Add(process, name, category, 'i', Now(), TimePoint(), args);
+}
+
+void Broker::_Recorder::Complete(
+    size_t process,
+    const std::string& name,
+    const char* category,
+    TimePoint start,
+    const std::string& args)
+{
+    _Add(process, name, category, 'X', start, Now(), args);
+}
+
+void Broker::_Recorder::_Add(
+    size_t process,
+    const std::string& name,
+    const char* category,
+    char phase,
+    TimePoint start,
+    TimePoint end,
+    const std::string& args)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_stream) {
+        return;
+    }
+
+    // Threads are identified by small integers in order of appearance.
+    auto result =
+        _threads.emplace(std::this_thread::get_id(), _threads.size() + 1);
+
+    _stream << (_eventCount++ > 0 ? ",\n" : "\n");
+    _stream << "{\"name\": \"" << _Escape(name) << "\", "
+            << "\"cat\": \"" << category << "\", "
+            << "\"ph\": \"" << phase << "\", "
+            << "\"ts\": " << _ToMicroseconds(start) << ", ";
+
+    if (phase == 'X') {
+        const double duration = _ToMicroseconds(end) - _ToMicroseconds(start);
+        _stream << "\"dur\": " << duration << ", ";
+    }
+    // Instant events are scoped to their thread.
+    else if (phase == 'i') {
+        _stream << "\"s\": \"t\", ";
+    }
+
+    _stream << "\"pid\": " << process << ", "
+            << "\"tid\": " << result.first->second << ", "
+            << "\"args\": {" << args << "}}";
+}
+
+double Broker::_Recorder::_ToMicroseconds(TimePoint time) const
+{
+    if (time < _origin) {
+        return 0.0;
+    }
+
+    return std::chrono::duration<double, std::micro>(time - _origin).count();
+}
+
+std::string Broker::_Recorder::_GetSessionFilePath(
+    const std::string& filePath, size_t session)
+{
+    if (session == 0) {
+        return filePath;
+    }
+
+    const size_t separator = filePath.find_last_of("/\\");
+    size_t extension = filePath.rfind('.');
+    if (extension == std::string::npos
+        || (separator != std::string::npos && extension < separator)) {
+        extension = filePath.size();
+    }
+
+    return filePath.substr(0, extension) + "." + std::to_string(session)
+           + filePath.substr(extension);
+}
+
+std::string Broker::_Recorder::_Escape(const std::string& text)
+{
+    std::string result;
+    result.reserve(text.size());
+
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            result += buffer;
+        }
+        else {
+            result += c;
+        }
+    }
+
+    return result;
+}
+
+}  // namespace unf
@@ -0,0 +1,114 @@
+#ifndef USD_NOTICE_FRAMEWORK_RECORDER_H
+#define USD_NOTICE_FRAMEWORK_RECORDER_H
+
+/// \file unf/recorder.h
+
+#include "unf/broker.h"
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace unf {
+
+/// \class Broker::_Recorder
+///
+/// \brief
+/// Write timestamped events into a Chrome trace JSON file, which can be
+/// visualized with Perfetto or chrome://tracing.
+///
+/// A recorder can be shared by several brokers, each one being displayed as
+/// a separate process. Events are written as they are recorded, and the
+/// file is completed when the recording is stopped, or when the last broker
+/// using the recorder is destroyed.
+class Broker::_Recorder {
+  public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    /// Create file at \p filePath, replacing any existing file.
+    _Recorder(const std::string& filePath);
+
+    /// Complete the file once no brokers use the recorder anymore.
+    ~_Recorder();
+
+    /// \brief
+    /// Return recorder shared by all brokers if the UNF_TRACE_FILE
+    /// environment variable is set, or a null pointer.
+    ///
+    /// The recorder is only held by brokers, so that the file is completed
+    /// once the last broker is destroyed. Recorders created afterwards
+    /// write into a new file with the session number inserted before the
+    /// extension, so that previous files are not overwritten.
+    static std::shared_ptr<_Recorder> GetFromEnvironment();
+
+    /// Return current time.
+    static TimePoint Now() { return std::chrono::steady_clock::now(); }
+
+    /// Indicate whether events can be written into the file.
+    bool IsValid() const { return static_cast<bool>(_stream); }
+
+    /// Return identifier of a new process labelled with \p name.
+    size_t AddProcess(const std::string& name);
+
+    /// Record beginning of a duration on the calling thread.
+    void Begin(size_t process, const char* name, const char* category);
+
+    /// Record end of a duration on the calling thread.
+    void End(size_t process, const char* name, const char* category);
+
+    /// Record event without duration.
+    void Instant(
+        size_t process,
+        const std::string& name,
+        const char* category,
+        const std::string& args);
+
+    /// Record duration from \p start to now.
+    void Complete(
+        size_t process,
+        const std::string& name,
+        const char* category,
+        TimePoint start,
+        const std::string& args);
+
+  private:
+    /// Write event into the file as soon as it is recorded, so that events
+    /// are not accumulated in memory.
+    void _Add(
+        size_t process,
+        const std::string& name,
+        const char* category,
+        char phase,
+        TimePoint start,
+        TimePoint end,
+        const std::string& args);
+
+    /// Return \p time relative to the creation of the recorder.
+    double _ToMicroseconds(TimePoint time) const;
+
+    /// Return file path with \p session number inserted before the
+    /// extension, unless this is the first session.
+    static std::string _GetSessionFilePath(
+        const std::string& filePath, size_t session);
+
+    /// Return \p text escaped as a JSON string.
+    static std::string _Escape(const std::string& text);
+
+    std::string _filePath;
+    std::ofstream _stream;
+    TimePoint _origin;
+
+    std::mutex _mutex;
+    std::unordered_map<std::thread::id, size_t> _threads;
+    size_t _processCount = 0;
+    size_t _eventCount = 0;
+};
+
+}  // namespace unf
+
+#endif  // USD_NOTICE_FRAMEWORK_RECORDER_H
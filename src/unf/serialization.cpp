@@ -0,0 +1,328 @@
+#include "unf/serialization.h"
+#include "unf/notice.h"
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace unf {
+
+namespace {
+
+// Paths which are never encoded from their parent path, as they do not have
+// any element. They are pre-recorded in the same order in each path table.
+std::vector<SdfPath> GetSeededPaths()
+{
+    return {
+        SdfPath::EmptyPath(),
+        SdfPath::AbsoluteRootPath(),
+        SdfPath::ReflexiveRelativePath()};
+}
+
+}  // anonymous namespace
+
+NoticeWriter::NoticeWriter()
+{
+    for (const auto& path : GetSeededPaths()) {
+        _paths.emplace(path, _paths.size());
+    }
+}
+
+void NoticeWriter::WriteVarint(uint64_t value)
+{
+    // Write seven bits per byte, with the high bit indicating whether more
+    // bytes follow.
+    while (value >= 0x80) {
+        _data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    _data.push_back(static_cast<char>(value));
+}
+
+void NoticeWriter::WriteString(const std::string& value)
+{
+    auto result = _strings.emplace(value, _strings.size());
+    WriteVarint(result.first->second);
+
+    // New entries are defined inline, after their index.
+    if (result.second) {
+        WriteVarint(value.size());
+        _data.append(value);
+    }
+}
+
+void NoticeWriter::WriteToken(const TfToken& value)
+{
+    WriteString(value.GetString());
+}
+
+void NoticeWriter::WritePath(const SdfPath& value)
+{
+    auto result = _paths.emplace(value, _paths.size());
+    WriteVarint(result.first->second);
+
+    // New entries are defined inline, after their index, from their parent
+    // path and their last element.
+    if (result.second) {
+        WritePath(value.GetParentPath());
+        WriteToken(value.GetElementToken());
+    }
+}
+
+void NoticeWriter::WriteStrings(const std::vector<std::string>& values)
+{
+    WriteVarint(values.size());
+    for (const auto& value : values) {
+        WriteString(value);
+    }
+}
+
+void NoticeWriter::WritePaths(const SdfPathVector& values)
+{
+    WriteVarint(values.size());
+    for (const auto& value : values) {
+        WritePath(value);
+    }
+}
+
+std::string NoticeWriter::TakeData()
+{
+    std::string data;
+    data.swap(_data);
+    return data;
+}
+
+NoticeReader::NoticeReader(std::string data)
+    : _storage(std::move(data)),
+      _data(_storage.data()),
+      _size(_storage.size()),
+      _paths(GetSeededPaths())
+{
+}
+
+NoticeReader::NoticeReader(const char* data, size_t size)
+    : _data(data), _size(size), _paths(GetSeededPaths())
+{
+}
+
+void NoticeReader::Append(const std::string& data)
+{
+    // Discard data already decoded.
+    std::string storage(_data + _position, _size - _position);
+    storage.append(data);
+
+    _storage.swap(storage);
+    _data = _storage.data();
+    _size = _storage.size();
+    _position = 0;
+}
+
+uint64_t NoticeReader::ReadVarint()
+{
+    uint64_t value = 0;
+
+    for (size_t shift = 0; _valid; shift += 7) {
+        if (_position >= _size || shift > 63) {
+            _Invalidate("Unexpected end of integer");
+            break;
+        }
+
+        const uint8_t byte = static_cast<uint8_t>(_data[_position++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+
+    return 0;
+}
+
+std::string NoticeReader::ReadString()
+{
+    const uint64_t index = ReadVarint();
+    if (!_valid) {
+        return std::string();
+    }
+
+    if (index < _strings.size()) {
+        return _strings[index];
+    }
+
+    // Otherwise, the string must be defined inline as the next entry.
+    if (index != _strings.size()) {
+        _Invalidate("Unknown string index");
+        return std::string();
+    }
+
+    const uint64_t size = ReadVarint();
+    if (!_valid) {
+        return std::string();
+    }
+
+    if (size > _size - _position) {
+        _Invalidate("Unexpected end of string");
+        return std::string();
+    }
+
+    _strings.emplace_back(_data + _position, size);
+    _position += size;
+
+    return _strings.back();
+}
+
+TfToken NoticeReader::ReadToken() { return TfToken(ReadString()); }
+
+SdfPath NoticeReader::ReadPath()
+{
+    // Paths defined inline are preceded by their parent path, which can be
+    // defined inline as well. Pending definitions are recorded in a stack
+    // rather than decoded recursively, so that corrupted data with long
+    // chains of definitions cannot exhaust the call stack.
+    std::vector<size_t> pending;
+    SdfPath path;
+
+    while (true) {
+        const uint64_t index = ReadVarint();
+        if (!_valid) {
+            return SdfPath();
+        }
+
+        if (index < _paths.size()) {
+            path = _paths[index];
+            break;
+        }
+
+        // Otherwise, the path must be defined inline as the next entry. Its
+        // slot is reserved before reading the parent path, which can define
+        // further entries.
+        if (index != _paths.size()) {
+            _Invalidate("Unknown path index");
+            return SdfPath();
+        }
+
+        _paths.emplace_back();
+        pending.push_back(index);
+    }
+
+    // Define pending paths from their parent path and their last element,
+    // starting from the closest to the parent path decoded.
+    while (!pending.empty()) {
+        const TfToken element = ReadToken();
+        if (!_valid) {
+            return SdfPath();
+        }
+
+        path = path.AppendElementToken(element);
+        if (path.IsEmpty()) {
+            _Invalidate("Invalid path element");
+            return SdfPath();
+        }
+
+        _paths[pending.back()] = path;
+        pending.pop_back();
+    }
+
+    return path;
+}
+
+std::vector<std::string> NoticeReader::ReadStrings()
+{
+    std::vector<std::string> values;
+
+    const uint64_t size = ReadVarint();
+    for (uint64_t i = 0; i < size && _valid; ++i) {
+        values.push_back(ReadString());
+    }
+
+    return values;
+}
+
+SdfPathVector NoticeReader::ReadPaths()
+{
+    SdfPathVector values;
+
+    const uint64_t size = ReadVarint();
+    for (uint64_t i = 0; i < size && _valid; ++i) {
+        values.push_back(ReadPath());
+    }
+
+    return values;
+}
+
+void NoticeReader::_Invalidate(const char* reason)
+{
+    if (_valid) {
+        TF_RUNTIME_ERROR("Failed to decode notice data: %s.", reason);
+    }
+
+    _valid = false;
+}
+
+namespace {
+
+// Return type of notice if it can be serialized, or an unknown type.
+TfType GetSerializableType(const UnfNotice::StageNotice& notice)
+{
+    const TfType& type = TfType::Find(typeid(notice));
+    if (type.IsUnknown() || !type.GetFactory<NoticeSerializerFactory>()) {
+        return TfType();
+    }
+
+    return type;
+}
+
+}  // anonymous namespace
+
+bool CanSerializeNotice(const UnfNotice::StageNotice& notice)
+{
+    return !GetSerializableType(notice).IsUnknown();
+}
+
+bool SerializeNotice(
+    const UnfNotice::StageNotice& notice, NoticeWriter& writer)
+{
+    const TfType type = GetSerializableType(notice);
+    if (type.IsUnknown()) {
+        return false;
+    }
+
+    writer.WriteString(type.GetTypeName());
+    notice.Serialize(writer);
+    return true;
+}
+
+UnfNotice::StageNoticeRefPtr DeserializeNotice(NoticeReader& reader)
+{
+    const std::string typeName = reader.ReadString();
+    if (!reader.IsValid()) {
+        return UnfNotice::StageNoticeRefPtr();
+    }
+
+    const TfType& type = TfType::FindByName(typeName);
+    auto factory = type.GetFactory<NoticeSerializerFactory>();
+    if (!factory) {
+        TF_RUNTIME_ERROR(
+            "Failed to deserialize notice with unknown type '%s'.",
+            typeName.c_str());
+        return UnfNotice::StageNoticeRefPtr();
+    }
+
+    UnfNotice::StageNoticeRefPtr notice = factory->Deserialize(reader);
+    if (!reader.IsValid()) {
+        return UnfNotice::StageNoticeRefPtr();
+    }
+
+    return notice;
+}
+
+}  // namespace unf
@@ -0,0 +1,235 @@
+#ifndef USD_NOTICE_FRAMEWORK_SERIALIZATION_H
+#define USD_NOTICE_FRAMEWORK_SERIALIZATION_H
+
+/// \file unf/serialization.h
+
+#include "unf/api.h"
+#include "unf/notice.h"
+
+#include <pxr/base/tf/refPtr.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace unf {
+
+/// \class NoticeWriter
+///
+/// \brief
+/// Encode notices into a compact binary buffer.
+///
+/// Integers are encoded as variable-length integers. Strings, tokens and
+/// paths are recorded in tables the first time they are written, and are
+/// referenced by their index in the table afterwards. Paths are recorded
+/// from their parent path and their last element, so that common prefixes
+/// are only encoded once.
+///
+/// Tables are preserved when data is taken from the writer, so that a
+/// stream of notices can be encoded progressively. The data must then be
+/// decoded by a single NoticeReader in the same order.
+///
+/// \sa SerializeNotice
+/// \sa NoticeReader
+class NoticeWriter {
+  public:
+    UNF_API NoticeWriter();
+
+    /// Write unsigned integer.
+    UNF_API void WriteVarint(uint64_t value);
+
+    /// Write string.
+    UNF_API void WriteString(const std::string& value);
+
+    /// Write token.
+    UNF_API void WriteToken(const PXR_NS::TfToken& value);
+
+    /// Write path.
+    UNF_API void WritePath(const PXR_NS::SdfPath& value);
+
+    /// Write number of elements followed by each string of \p values.
+    UNF_API void WriteStrings(const std::vector<std::string>& values);
+
+    /// Write number of elements followed by each path of \p values.
+    UNF_API void WritePaths(const PXR_NS::SdfPathVector& values);
+
+    /// Return data encoded since the last call to TakeData.
+    const std::string& GetData() const { return _data; }
+
+    /// Return data encoded since the last call to TakeData and clear it.
+    UNF_API std::string TakeData();
+
+  private:
+    std::string _data;
+
+    /// Index of strings and tokens written.
+    std::unordered_map<std::string, uint64_t> _strings;
+
+    /// Index of paths written.
+    std::unordered_map<PXR_NS::SdfPath, uint64_t, PXR_NS::SdfPath::Hash>
+        _paths;
+};
+
+/// \class NoticeReader
+///
+/// \brief
+/// Decode notices from a binary buffer encoded by a NoticeWriter.
+///
+/// If the data is truncated or corrupted, the reader is invalidated and
+/// default values are returned.
+///
+/// \sa DeserializeNotice
+/// \sa NoticeWriter
+class NoticeReader {
+  public:
+    /// Create reader decoding \p data.
+    UNF_API NoticeReader(std::string data = std::string());
+
+    /// \brief
+    /// Create reader decoding \p size bytes from \p data without copying
+    /// them.
+    ///
+    /// The buffer must remain valid while the reader is used, unless more
+    /// data is appended.
+    UNF_API NoticeReader(const char* data, size_t size);
+
+    NoticeReader(const NoticeReader&) = delete;
+    NoticeReader& operator=(const NoticeReader&) = delete;
+
+    /// Append encoded \p data to decode.
+    UNF_API void Append(const std::string& data);
+
+    /// Indicate whether all data has been decoded.
+    bool AtEnd() const { return _position >= _size; }
+
+    /// Indicate whether data could be decoded so far.
+    bool IsValid() const { return _valid; }
+
+    /// Read unsigned integer.
+    UNF_API uint64_t ReadVarint();
+
+    /// Read string.
+    UNF_API std::string ReadString();
+
+    /// Read token.
+    UNF_API PXR_NS::TfToken ReadToken();
+
+    /// Read path.
+    UNF_API PXR_NS::SdfPath ReadPath();
+
+    /// Read number of elements followed by each string.
+    UNF_API std::vector<std::string> ReadStrings();
+
+    /// Read number of elements followed by each path.
+    UNF_API PXR_NS::SdfPathVector ReadPaths();
+
+  private:
+    /// Invalidate reader and report \p reason.
+    void _Invalidate(const char* reason);
+
+    /// Data appended to the reader, if any.
+    std::string _storage;
+
+    /// Data decoded, referencing either _storage or an external buffer.
+    const char* _data;
+    size_t _size;
+
+    size_t _position = 0;
+    bool _valid = true;
+
+    /// Strings and tokens read, indexed by their position in the table.
+    std::vector<std::string> _strings;
+
+    /// Paths read, indexed by their position in the table.
+    std::vector<PXR_NS::SdfPath> _paths;
+};
+
+/// \brief
+/// Indicate whether \p notice can be serialized.
+///
+/// \sa NoticeSerializerDefine
+UNF_API bool CanSerializeNotice(const UnfNotice::StageNotice& notice);
+
+/// \brief
+/// Write \p notice with its type name into \p writer.
+///
+/// Return false without writing anything if the notice type does not support
+/// serialization.
+///
+/// \sa NoticeSerializerDefine
+UNF_API bool SerializeNotice(
+    const UnfNotice::StageNotice& notice, NoticeWriter& writer);
+
+/// \brief
+/// Read next notice from \p reader.
+///
+/// Return a null pointer if the notice type cannot be found or if the data
+/// is invalid.
+UNF_API UnfNotice::StageNoticeRefPtr DeserializeNotice(NoticeReader& reader);
+
+/// \class NoticeSerializerFactory
+///
+/// \brief
+/// Interface for building notices from serialized data.
+///
+/// \sa
+/// NoticeSerializerFactoryImpl
+class NoticeSerializerFactory : public PXR_NS::TfType::FactoryBase {
+  public:
+    /// Base method to create a notice from \p reader.
+    virtual UnfNotice::StageNoticeRefPtr Deserialize(
+        NoticeReader& reader) const = 0;
+};
+
+/// \class NoticeSerializerFactoryImpl
+///
+/// \brief
+/// Templated factory class which creates a specific type of notice from
+/// serialized data.
+///
+/// The notice type must override UnfNotice::StageNotice::Serialize and
+/// provide a static \c Deserialize method returning a new notice from a
+/// NoticeReader.
+///
+/// \sa
+/// NoticeSerializerDefine
+template <class T>
+class NoticeSerializerFactoryImpl : public NoticeSerializerFactory {
+  public:
+    /// Create a notice and return reference pointer.
+    virtual UnfNotice::StageNoticeRefPtr Deserialize(
+        NoticeReader& reader) const override
+    {
+        return T::Deserialize(reader);
+    }
+};
+
+/// \fn NoticeSerializerDefine
+///
+/// \brief
+/// Define a PXR_NS::TfType for a type of notice which can be serialized.
+///
+/// Typical usage to define a type for a notice \p Foo would be:
+///
+/// \code{.cpp}
+/// TF_REGISTRY_FUNCTION(PXR_NS::TfType)
+/// {
+///     NoticeSerializerDefine<Foo, UnfNotice::StageNotice>();
+/// }
+/// \endcode
+template <class T, class... Bases>
+void NoticeSerializerDefine()
+{
+    PXR_NS::TfType::Define<T, PXR_NS::TfType::Bases<Bases...> >()
+        .template SetFactory<NoticeSerializerFactoryImpl<T> >();
+}
+
+}  // namespace unf
+
+#endif  // USD_NOTICE_FRAMEWORK_SERIALIZATION_H
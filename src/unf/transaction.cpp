@@ -10,31 +10,39 @@ PXR_NAMESPACE_USING_DIRECTIVE
 namespace unf {
 
 NoticeTransaction::NoticeTransaction(
-    const BrokerPtr& broker, CapturePredicate predicate)
+    const BrokerPtr& broker,
+    CapturePredicate predicate,
+    TransactionScope scope)
     : _broker(broker)
 {
-    _broker->BeginTransaction(predicate);
+    _broker->BeginTransaction(predicate, scope);
 }
 
 NoticeTransaction::NoticeTransaction(
-    const BrokerPtr& broker, const CapturePredicateFunc& predicate)
+    const BrokerPtr& broker,
+    const CapturePredicateFunc& predicate,
+    TransactionScope scope)
     : _broker(broker)
 {
-    _broker->BeginTransaction(predicate);
+    _broker->BeginTransaction(predicate, scope);
 }
 
 NoticeTransaction::NoticeTransaction(
-    const UsdStageRefPtr& stage, CapturePredicate predicate)
+    const UsdStageRefPtr& stage,
+    CapturePredicate predicate,
+    TransactionScope scope)
     : _broker(Broker::Create(stage))
 {
-    _broker->BeginTransaction(predicate);
+    _broker->BeginTransaction(predicate, scope);
 }
 
 NoticeTransaction::NoticeTransaction(
-    const PXR_NS::UsdStageRefPtr& stage, const CapturePredicateFunc& predicate)
+    const PXR_NS::UsdStageRefPtr& stage,
+    const CapturePredicateFunc& predicate,
+    TransactionScope scope)
     : _broker(Broker::Create(stage))
 {
-    _broker->BeginTransaction(predicate);
+    _broker->BeginTransaction(predicate, scope);
 }
 
 NoticeTransaction::~NoticeTransaction() { _broker->EndTransaction(); }
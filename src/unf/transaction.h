@@ -30,9 +30,16 @@ class NoticeTransaction {
     /// the entire scope of the transaction. A CapturePredicate can be passed to
     /// influence which notices are captured. Notices that are not captured
     /// will not be emitted.
+    ///
+    /// By default, only notices sent from the calling thread are captured.
+    /// A TransactionScope can be passed to also capture notices sent from
+    /// other threads.
+    ///
+    /// \sa Broker::BeginTransaction
     UNF_API NoticeTransaction(
         const BrokerPtr &,
-        CapturePredicate predicate = CapturePredicate::Default());
+        CapturePredicate predicate = CapturePredicate::Default(),
+        TransactionScope scope = TransactionScope::Thread);
 
     /// \brief
     /// Create transaction from a Broker with a capture predicate function.
@@ -42,10 +49,13 @@ class NoticeTransaction {
     ///
     /// \code{.cpp}
     /// NoticeTransaction t(broker, [&](const unf::UnfNotice::StageNotice& n) {
-    ///     return (n.GetTypeId() != typeid(Foo).name());
+    ///     return (n.GetTypeKey() != Foo::StaticTypeKey());
     /// });
     /// \endcode
-    UNF_API NoticeTransaction(const BrokerPtr &, const CapturePredicateFunc &);
+    UNF_API NoticeTransaction(
+        const BrokerPtr &,
+        const CapturePredicateFunc &,
+        TransactionScope scope = TransactionScope::Thread);
 
     /// \brief
     /// Create transaction from a UsdStage.
@@ -57,7 +67,8 @@ class NoticeTransaction {
     /// CapturePredicate::Default())
     UNF_API NoticeTransaction(
         const PXR_NS::UsdStageRefPtr &,
-        CapturePredicate predicate = CapturePredicate::Default());
+        CapturePredicate predicate = CapturePredicate::Default(),
+        TransactionScope scope = TransactionScope::Thread);
 
     /// \brief
     /// Create transaction from a UsdStage with a capture predicate function.
@@ -68,7 +79,9 @@ class NoticeTransaction {
     /// NoticeTransaction(const BrokerPtr &, const CapturePredicateFunc&)
 
     UNF_API NoticeTransaction(
-        const PXR_NS::UsdStageRefPtr &, const CapturePredicateFunc &);
+        const PXR_NS::UsdStageRefPtr &,
+        const CapturePredicateFunc &,
+        TransactionScope scope = TransactionScope::Thread);
 
     /// Delete object and end transaction.
     UNF_API virtual ~NoticeTransaction();
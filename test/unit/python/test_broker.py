@@ -1,6 +1,10 @@
 # -*- coding: utf-8 -*-
 
-from pxr import Usd
+import json
+import sys
+import threading
+
+from pxr import Usd, Tf
 import unf
 
 
@@ -51,3 +55,263 @@ def test_broker_transaction_nested():
     broker.EndTransaction()
     assert broker.IsInTransaction() is False
 
+def test_broker_merge_on_capture():
+    """Enable notice merging on capture."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+    assert broker.GetMergeOnCapture() is False
+
+    broker.SetMergeOnCapture(True)
+    assert broker.GetMergeOnCapture() is True
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    broker.BeginTransaction()
+    stage.DefinePrim("/Foo")
+    stage.DefinePrim("/Bar")
+    broker.EndTransaction()
+
+    # Ensure that one consolidated notice was received.
+    assert len(received) == 1
+    assert received[0].GetResyncedPaths() == ["/Bar", "/Foo"]
+
+def test_broker_async_delivery():
+    """Deliver notices on a background thread."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+    assert broker.GetAsyncDelivery() is False
+
+    broker.SetAsyncDelivery(True)
+    assert broker.GetAsyncDelivery() is True
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    broker.BeginTransaction()
+    stage.DefinePrim("/Foo")
+    stage.DefinePrim("/Bar")
+    broker.EndTransaction()
+
+    broker.WaitForDelivery()
+
+    # Ensure that one consolidated notice was received.
+    assert len(received) == 1
+    assert received[0].GetResyncedPaths() == ["/Bar", "/Foo"]
+
+    broker.SetAsyncDelivery(False)
+    assert broker.GetAsyncDelivery() is False
+
+def test_broker_debounce():
+    """Collect notices sent outside of transactions."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+    assert broker.IsDebounceEnabled() is False
+
+    broker.EnableDebounce(quietPeriod=60000, maxLatency=60000)
+    assert broker.IsDebounceEnabled() is True
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    stage.DefinePrim("/Foo")
+    stage.DefinePrim("/Bar")
+
+    assert broker.Poll() is False
+    assert len(received) == 0
+
+    broker.Flush()
+
+    # Ensure that one consolidated notice was received.
+    assert len(received) == 1
+    assert received[0].GetResyncedPaths() == ["/Bar", "/Foo"]
+
+    broker.DisableDebounce()
+    assert broker.IsDebounceEnabled() is False
+
+def test_broker_end_transaction_releases_gil():
+    """Let other Python threads progress while ending a transaction."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+
+    counter = [0]
+    started = threading.Event()
+    stopped = threading.Event()
+
+    def _count():
+        """Increment counter until stopped."""
+        started.set()
+        while not stopped.is_set():
+            counter[0] += 1
+
+    broker.BeginTransaction()
+
+    for index in range(5000):
+        stage.DefinePrim("/Foo{}".format(index))
+
+    thread = threading.Thread(target=_count)
+    thread.start()
+    started.wait()
+
+    # Prevent thread from preempting the main thread while it runs Python
+    # code, so that the counter can only progress when the GIL is released.
+    interval = sys.getswitchinterval()
+    sys.setswitchinterval(0.5)
+
+    try:
+        count = counter[0]
+        broker.EndTransaction()
+
+        # Ensure that the thread made progress while notices were merged.
+        assert counter[0] > count
+    finally:
+        sys.setswitchinterval(interval)
+        stopped.set()
+        thread.join()
+
+def test_broker_statistics():
+    """Query counters describing notices processed by the broker."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+
+    broker.BeginTransaction()
+    stage.DefinePrim("/Foo")
+    broker.EndTransaction()
+
+    # Times are not recorded by default.
+    assert broker.GetTimeTracking() is False
+    statistics = broker.GetStatistics()
+    assert statistics.captureTime == 0
+    assert statistics.sendTime == 0
+
+    broker.ResetStatistics()
+    broker.SetTimeTracking(True)
+    assert broker.GetTimeTracking() is True
+
+    broker.BeginTransaction()
+    stage.DefinePrim("/Foo")
+    stage.DefinePrim("/Bar")
+    broker.EndTransaction()
+
+    statistics = broker.GetStatistics()
+    notices = {notice.typeName: notice for notice in statistics.notices}
+
+    notice = notices["unf::UnfNotice::ObjectsChanged"]
+    assert notice.received == 2
+    assert notice.captured == 2
+    assert notice.filtered == 0
+    assert notice.merged == 1
+    assert notice.sent == 1
+
+    assert statistics.captureTime > 0
+    assert statistics.sendTime > 0
+
+    broker.ResetStatistics()
+
+    statistics = broker.GetStatistics()
+    assert len(statistics.notices) == 0
+    assert statistics.captureTime == 0
+
+def test_broker_latency_tracking():
+    """Record time spent delivering notices to listeners."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+    assert broker.GetLatencyTracking() is False
+
+    broker.SetLatencyTracking(True)
+    assert broker.GetLatencyTracking() is True
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    stage.DefinePrim("/Foo")
+    stage.DefinePrim("/Bar")
+
+    broker.SetLatencyTracking(False)
+    assert broker.GetLatencyTracking() is False
+    assert len(received) == 2
+
+    latencies = [
+        latency for latency in broker.GetStatistics().latencies
+        if latency.typeName == "unf::UnfNotice::ObjectsChanged"
+        and latency.listenerName == ""
+    ]
+
+    assert len(latencies) == 1
+    assert latencies[0].count == 2
+    assert 0 < latencies[0].p50 <= latencies[0].p99 <= latencies[0].max
+
+def test_broker_recording(tmp_path):
+    """Record activity of the broker into a Chrome trace file."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+    assert broker.IsRecording() is False
+
+    path = str(tmp_path / "trace.json")
+
+    broker.StartRecording(path)
+    assert broker.IsRecording() is True
+
+    with unf.NoticeTransaction(broker):
+        stage.DefinePrim("/Foo")
+        stage.DefinePrim("/Bar")
+
+    broker.StopRecording()
+    assert broker.IsRecording() is False
+
+    with open(path) as stream:
+        data = json.load(stream)
+
+    events = [
+        event for event in data["traceEvents"]
+        if event["name"] == "unf::UnfNotice::ObjectsChanged"
+    ]
+
+    assert [event["cat"] for event in events] == ["capture", "capture", "send"]
+    assert events[-1]["args"]["paths"] == 2
+
+def test_broker_journal(tmp_path):
+    """Record notices into a journal file."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+    assert broker.IsJournaling() is False
+
+    path = str(tmp_path / "notices.unfj")
+
+    broker.StartJournal(path, unf.JournalMode.Captured)
+    assert broker.IsJournaling() is True
+
+    with unf.NoticeTransaction(broker):
+        stage.DefinePrim("/Foo")
+        stage.DefinePrim("/Bar")
+
+    broker.StopJournal()
+    assert broker.IsJournaling() is False
+
+    with open(path, "rb") as stream:
+        data = stream.read()
+
+    assert data.startswith(b"UNFJ")
+    assert b"unf::UnfNotice::ObjectsChanged" in data
+    assert b"Foo" in data
+    assert b"Bar" in data
@@ -17,6 +17,7 @@ def test_objects_changed():
         """Validate notice received."""
         assert notice.IsMergeable() is True
         assert notice.GetTypeId() == "unf::UnfNotice::ObjectsChanged"
+        assert isinstance(notice.GetTypeKey(), int)
         received.append(notice)
 
     key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
@@ -42,6 +43,9 @@ def test_objects_changed_resynced_object():
         assert notice.ResyncedObject(stage.GetPrimAtPath("/Bar")) is True
         assert notice.AffectedObject(stage.GetPrimAtPath("/Foo")) is False
         assert notice.AffectedObject(stage.GetPrimAtPath("/Bar")) is True
+        assert notice.ResyncedObject(Sdf.Path("/Foo")) is False
+        assert notice.ResyncedObject(Sdf.Path("/Bar/Baz")) is True
+        assert notice.AffectedObject(Sdf.Path("/Bar/Baz")) is True
         received.append(notice)
 
     key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
@@ -1,5 +1,7 @@
 # -*- coding: utf-8 -*-
 
+import threading
+
 from pxr import Usd, Tf
 import unf
 
@@ -121,6 +123,107 @@ def test_transaction_create_from_broker_with_blockall_predicate():
     # Ensure that no notices were received.
     assert len(received) == 0
 
+def test_transaction_create_from_broker_with_combined_predicates():
+    """Create a transaction with combined predicates."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    predicate = (
+        unf.CapturePredicate.Default() & unf.CapturePredicate.BlockAll()
+    )
+    assert predicate.IsTypeBased() is True
+
+    with unf.NoticeTransaction(broker, predicate=predicate):
+        stage.DefinePrim("/Foo")
+
+    # Ensure that no notices were received.
+    assert len(received) == 0
+
+    predicate = ~unf.CapturePredicate.BlockAll() | predicate
+    assert predicate.IsTypeBased() is True
+
+    with unf.NoticeTransaction(broker, predicate=predicate):
+        stage.DefinePrim("/Bar")
+
+    # Ensure that one notice was received.
+    assert len(received) == 1
+
+def test_transaction_create_from_broker_with_per_type_predicate():
+    """Create a transaction with a predicate evaluated once per type."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    calls = []
+
+    def _predicate(notice):
+        """Only capture ObjectsChanged notices."""
+        calls.append(type(notice))
+        return isinstance(notice, unf.Notice.ObjectsChanged)
+
+    with unf.NoticeTransaction(broker, predicate=_predicate, perType=True):
+        stage.DefinePrim("/Foo")
+        stage.DefinePrim("/Bar")
+
+    # Ensure that one notice was received.
+    assert len(received) == 1
+
+    # Ensure that predicate was only called once per notice type.
+    assert len(calls) == len(set(calls))
+
+def test_transaction_create_from_broker_with_type_predicates():
+    """Create a transaction with predicates created from notice types."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        received.append(notice)
+
+    key1 = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+    key2 = Tf.Notice.Register(
+        unf.Notice.StageContentsChanged, _validate, stage
+    )
+
+    predicate = unf.CapturePredicate.IncludeTypes(
+        [unf.Notice.ObjectsChanged]
+    )
+
+    with unf.NoticeTransaction(broker, predicate=predicate):
+        stage.DefinePrim("/Foo")
+
+    # Ensure that only the ObjectsChanged notice was received.
+    assert len(received) == 1
+    assert isinstance(received[0], unf.Notice.ObjectsChanged)
+
+    predicate = unf.CapturePredicate.ExcludeTypes(
+        [unf.Notice.ObjectsChanged]
+    )
+
+    with unf.NoticeTransaction(broker, predicate=predicate):
+        stage.DefinePrim("/Bar")
+
+    # Ensure that only the StageContentsChanged notice was received.
+    assert len(received) == 2
+    assert isinstance(received[1], unf.Notice.StageContentsChanged)
+
 def test_transaction_create_from_stage():
     """Create a transaction from stage."""
     stage = Usd.Stage.CreateInMemory()
@@ -303,3 +406,31 @@ def test_transaction_nested_with_filter():
 
     # Ensure that one notice was received.
     assert len(received) == 1
+
+def test_transaction_concurrent_scope():
+    """Capture notices sent from other threads."""
+    stage = Usd.Stage.CreateInMemory()
+    broker = unf.Broker.Create(stage)
+
+    received = []
+
+    def _validate(notice, stage):
+        """Validate notice received."""
+        assert sorted(notice.GetResyncedPaths()) == ["/Bar", "/Foo"]
+        received.append(notice)
+
+    key = Tf.Notice.Register(unf.Notice.ObjectsChanged, _validate, stage)
+
+    with unf.NoticeTransaction(
+        broker, scope=unf.TransactionScope.Concurrent
+    ):
+        stage.DefinePrim("/Foo")
+
+        thread = threading.Thread(target=lambda: stage.DefinePrim("/Bar"))
+        thread.start()
+        thread.join()
+
+        assert len(received) == 0
+
+    # Ensure that one notice was received.
+    assert len(received) == 1
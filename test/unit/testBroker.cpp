@@ -3,6 +3,10 @@
 #include <gtest/gtest.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 TEST(BrokerTest, Create)
 {
     auto stage = PXR_NS::UsdStage::CreateInMemory();
@@ -51,6 +55,97 @@ TEST(BrokerTest, CleanRegistry)
     ASSERT_EQ(broker1->GetCurrentCount(), 1);
 }
 
+TEST(BrokerTest, CreateConcurrently)
+{
+    const size_t stageCount = 2000;
+    const size_t threadCount =
+        std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+    std::vector<PXR_NS::UsdStageRefPtr> stages;
+    for (size_t i = 0; i < stageCount; ++i) {
+        stages.push_back(PXR_NS::UsdStage::CreateInMemory());
+    }
+
+    // Each thread creates brokers for all stages, starting from a different
+    // offset so that creations and lookups are interleaved.
+    std::vector<std::vector<unf::BrokerPtr> > brokers(
+        threadCount, std::vector<unf::BrokerPtr>(stageCount));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < stageCount; ++i) {
+                size_t index = (i + t * stageCount / threadCount) % stageCount;
+                brokers[t][index] = unf::Broker::Create(stages[index]);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // A single broker has been created per stage.
+    for (size_t i = 0; i < stageCount; ++i) {
+        ASSERT_EQ(brokers[0][i]->GetStage(), stages[i]);
+
+        for (size_t t = 1; t < threadCount; ++t) {
+            ASSERT_EQ(brokers[t][i], brokers[0][i]);
+        }
+    }
+
+    unf::Broker::ResetAll();
+}
+
+TEST(BrokerTest, CleanRegistryMultiple)
+{
+    // Start from an empty registry so that the registered brokers are known.
+    unf::Broker::ResetAll();
+
+    // Several brokers targeting live stages are registered first.
+    const size_t liveCount = 8;
+
+    std::vector<PXR_NS::UsdStageRefPtr> stages;
+    for (size_t i = 0; i < liveCount; ++i) {
+        stages.push_back(PXR_NS::UsdStage::CreateInMemory());
+        unf::Broker::Create(stages.back());
+    }
+
+    auto stage1 = PXR_NS::UsdStage::CreateInMemory();
+    auto broker1 = unf::Broker::Create(stage1);
+
+    auto stage2 = PXR_NS::UsdStage::CreateInMemory();
+    auto broker2 = unf::Broker::Create(stage2);
+
+    auto stage3 = PXR_NS::UsdStage::CreateInMemory();
+    auto broker3 = unf::Broker::Create(stage3);
+
+    // Broker is reset and created again while stage is still alive.
+    broker2->Reset();
+    broker2 = unf::Broker::Create(stage2);
+    ASSERT_EQ(broker2->GetCurrentCount(), 2);
+
+    stage1.Reset();
+    stage3.Reset();
+    ASSERT_EQ(broker1->GetCurrentCount(), 2);
+    ASSERT_EQ(broker3->GetCurrentCount(), 2);
+
+    // Each new broker only inspects a bounded number of registered brokers,
+    // so registry references to expired stages are removed once enough
+    // brokers have been added to inspect all brokers registered before
+    // them.
+    for (size_t i = 0; i < liveCount; ++i) {
+        stages.push_back(PXR_NS::UsdStage::CreateInMemory());
+        unf::Broker::Create(stages.back());
+    }
+
+    ASSERT_EQ(broker1->GetCurrentCount(), 1);
+    ASSERT_EQ(broker2->GetCurrentCount(), 2);
+    ASSERT_EQ(broker3->GetCurrentCount(), 1);
+
+    unf::Broker::ResetAll();
+}
+
 TEST(BrokerTest, Reset)
 {
     auto stage = PXR_NS::UsdStage::CreateInMemory();
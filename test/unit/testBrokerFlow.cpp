@@ -6,7 +6,19 @@
 #include <unfTest/observer.h>
 
 #include <gtest/gtest.h>
+#include <pxr/base/tf/errorMark.h>
 #include <pxr/usd/usd/stage.h>
+#include <tbb/parallel_for.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 class BrokerFlowTest : public ::testing::Test {
   protected:
@@ -112,6 +124,507 @@ TEST_F(BrokerFlowTest, NestedTransaction)
     ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 6);
 }
 
+TEST_F(BrokerFlowTest, TransactionOrder)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    std::vector<std::string> received;
+
+    ::Test::Observer<::Test::MergeableNotice> observer1(_stage);
+    observer1.SetCallback([&](const ::Test::MergeableNotice&) {
+        received.push_back("Mergeable");
+    });
+
+    ::Test::Observer<::Test::UnMergeableNotice> observer2(_stage);
+    observer2.SetCallback([&](const ::Test::UnMergeableNotice&) {
+        received.push_back("UnMergeable");
+    });
+
+    // Notice types are emitted in the order of their first capture.
+    broker->BeginTransaction();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+    broker->EndTransaction();
+
+    ASSERT_EQ(
+        received,
+        std::vector<std::string>({"UnMergeable", "UnMergeable", "Mergeable"}));
+
+    received.clear();
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+
+    // Types captured in nested transactions are appended after types
+    // already captured.
+    broker->BeginTransaction();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    broker->EndTransaction();
+
+    ASSERT_EQ(
+        received,
+        std::vector<std::string>({"Mergeable", "UnMergeable", "UnMergeable"}));
+}
+
+TEST_F(BrokerFlowTest, BatchListener)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    std::vector<std::vector<std::string> > batches;
+
+    auto key = broker->AddBatchListener(
+        [&](const std::vector<unf::UnfNotice::StageNoticeRefPtr>& notices) {
+            std::vector<std::string> batch;
+            for (const auto& notice : notices) {
+                batch.push_back(notice->GetTypeId());
+            }
+            batches.push_back(batch);
+        });
+
+    // Notices of the outermost transaction are received in one batch once
+    // merged.
+    broker->BeginTransaction();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    ASSERT_EQ(batches.size(), 0);
+
+    broker->EndTransaction();
+
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(
+        batches[0],
+        std::vector<std::string>(
+            {"Test::UnMergeableNotice",
+             "Test::UnMergeableNotice",
+             "Test::MergeableNotice"}));
+
+    // Regular listeners still receive each notice.
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 2);
+
+    // Transactions without notices do not produce batches.
+    broker->BeginTransaction();
+    broker->EndTransaction();
+    ASSERT_EQ(batches.size(), 1);
+
+    // Notices sent outside of transactions are received individually.
+    broker->Send<::Test::MergeableNotice>();
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(
+        batches[1], std::vector<std::string>({"Test::MergeableNotice"}));
+
+    broker->RemoveBatchListener(key);
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>();
+    broker->EndTransaction();
+    ASSERT_EQ(batches.size(), 2);
+}
+
+TEST_F(BrokerFlowTest, TransactionPerThread)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    broker->BeginTransaction();
+    ASSERT_TRUE(broker->IsInTransaction());
+
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+
+    // Notices sent from another thread are not captured by the transaction.
+    std::thread thread([&]() {
+        ASSERT_FALSE(broker->IsInTransaction());
+
+        broker->Send<::Test::UnMergeableNotice>();
+        broker->Send<::Test::UnMergeableNotice>();
+        broker->Send<::Test::UnMergeableNotice>();
+    });
+    thread.join();
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 0);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 3);
+
+    broker->EndTransaction();
+    ASSERT_FALSE(broker->IsInTransaction());
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 3);
+}
+
+TEST_F(BrokerFlowTest, ConcurrentTransactions)
+{
+    const size_t threadCount = 8;
+    const size_t noticeCount = 100;
+
+    auto broker = unf::Broker::Create(_stage);
+
+    // Notices are received from the thread ending the transaction, so
+    // transactions are ended sequentially.
+    std::mutex mutex;
+    std::vector<::Test::DataMap> received;
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+    observer.SetCallback([&](const ::Test::MergeableNotice& notice) {
+        received.push_back(notice.GetData());
+    });
+
+    std::atomic<size_t> started(0);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            const std::string key = "Thread" + std::to_string(t);
+
+            broker->BeginTransaction();
+
+            for (size_t i = 0; i < noticeCount; ++i) {
+                broker->Send<::Test::MergeableNotice>(
+                    ::Test::DataMap({{key, std::to_string(i)}}));
+            }
+
+            // Wait for all transactions to be opened simultaneously.
+            started++;
+            while (started < threadCount) {
+                std::this_thread::yield();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            broker->EndTransaction();
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Each transaction only consolidated notices sent from its own thread.
+    ASSERT_EQ(received.size(), threadCount);
+
+    for (const auto& data : received) {
+        ASSERT_EQ(data.size(), 1);
+        ASSERT_EQ(data.begin()->second, std::to_string(noticeCount - 1));
+    }
+}
+
+TEST_F(BrokerFlowTest, ConcurrentCapture)
+{
+    const size_t noticeCount = 1000;
+
+    auto broker = unf::Broker::Create(_stage);
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+
+    broker->BeginTransaction(
+        unf::CapturePredicate::Default(), unf::TransactionScope::Concurrent);
+    ASSERT_TRUE(broker->IsInTransaction());
+
+    // Notices sent from a pool of threads are captured by the transaction.
+    tbb::parallel_for(size_t(0), noticeCount, [&](size_t i) {
+        ASSERT_TRUE(broker->IsInTransaction());
+
+        broker->Send<::Test::MergeableNotice>(
+            ::Test::DataMap({{"Key" + std::to_string(i), "Test"}}));
+        broker->Send<::Test::UnMergeableNotice>();
+    });
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 0);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 0);
+
+    broker->EndTransaction();
+    ASSERT_FALSE(broker->IsInTransaction());
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), noticeCount);
+
+    // Consolidated notice is identical to the one obtained from a single
+    // thread.
+    ::Test::DataMap expected;
+    for (size_t i = 0; i < noticeCount; ++i) {
+        expected["Key" + std::to_string(i)] = "Test";
+    }
+
+    ASSERT_EQ(observer.GetLatestNotice().GetData(), expected);
+}
+
+TEST_F(BrokerFlowTest, ConcurrentCaptureWithThreadTransaction)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    broker->BeginTransaction(
+        unf::CapturePredicate::Default(), unf::TransactionScope::Concurrent);
+
+    // Notices sent from a thread which started its own transaction are
+    // captured by this transaction.
+    std::thread thread([&]() {
+        broker->BeginTransaction();
+        broker->Send<::Test::MergeableNotice>();
+        broker->Send<::Test::MergeableNotice>();
+        broker->EndTransaction();
+    });
+    thread.join();
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+
+    broker->Send<::Test::MergeableNotice>();
+    broker->EndTransaction();
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 2);
+}
+
+TEST_F(BrokerFlowTest, ConcurrentCaptureEndedWhileSending)
+{
+    const size_t noticeCount = 10000;
+
+    // Notices are sent from worker threads once the transaction ends, so
+    // they are sent for a stage which is not observed by the listener.
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+
+    broker->BeginTransaction(
+        unf::CapturePredicate::Default(), unf::TransactionScope::Concurrent);
+
+    std::atomic<size_t> count{0};
+
+    std::thread thread([&]() {
+        tbb::parallel_for(size_t(0), noticeCount, [&](size_t) {
+            broker->Send<::Test::UnMergeableNotice>();
+            count.fetch_add(1);
+        });
+    });
+
+    // End transaction while notices are being sent.
+    while (count.load() < noticeCount / 2) {
+        std::this_thread::yield();
+    }
+    broker->EndTransaction();
+
+    thread.join();
+
+    // Each notice is either captured by the transaction or sent directly.
+    auto statistics = broker->GetStatistics();
+    ASSERT_EQ(statistics.notices.size(), 1);
+    ASSERT_EQ(statistics.notices[0].received, noticeCount);
+    ASSERT_EQ(statistics.notices[0].sent, noticeCount);
+}
+
+TEST_F(BrokerFlowTest, AsyncDelivery)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    ASSERT_FALSE(broker->GetAsyncDelivery());
+    broker->SetAsyncDelivery(true);
+    ASSERT_TRUE(broker->GetAsyncDelivery());
+
+    std::thread::id threadId;
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+    observer.SetCallback([&](const ::Test::MergeableNotice&) {
+        threadId = std::this_thread::get_id();
+    });
+
+    broker->BeginTransaction();
+
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+
+    broker->EndTransaction();
+    broker->WaitForDelivery();
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 2);
+
+    // Notices are delivered from a dedicated thread.
+    ASSERT_NE(threadId, std::this_thread::get_id());
+
+    broker->SetAsyncDelivery(false);
+    ASSERT_FALSE(broker->GetAsyncDelivery());
+}
+
+TEST_F(BrokerFlowTest, AsyncDeliveryOrder)
+{
+    const size_t noticeCount = 1000;
+
+    auto broker = unf::Broker::Create(_stage);
+    broker->SetAsyncDelivery(true);
+
+    std::vector<std::string> received;
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+    observer.SetCallback([&](const ::Test::MergeableNotice& notice) {
+        received.push_back(notice.GetData().at("Index"));
+    });
+
+    for (size_t i = 0; i < noticeCount; ++i) {
+        broker->Send<::Test::MergeableNotice>(
+            ::Test::DataMap({{"Index", std::to_string(i)}}));
+    }
+
+    // Pending notices are delivered when asynchronous delivery is disabled.
+    broker->SetAsyncDelivery(false);
+
+    ASSERT_EQ(received.size(), noticeCount);
+    for (size_t i = 0; i < noticeCount; ++i) {
+        ASSERT_EQ(received[i], std::to_string(i));
+    }
+}
+
+TEST_F(BrokerFlowTest, AsyncDeliveryExpiredStage)
+{
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+    broker->SetAsyncDelivery(true);
+
+    // Block the delivery thread within a listener waiting for a lock held by
+    // the thread destroying the broker, as a Python listener waiting for the
+    // GIL would.
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    std::atomic<bool> delivering{false};
+    std::atomic<size_t> received{0};
+
+    ::Test::Observer<::Test::MergeableNotice> observer(stage);
+    observer.SetCallback([&](const ::Test::MergeableNotice&) {
+        delivering = true;
+        { std::lock_guard<std::mutex> guard(mutex); }
+        received++;
+    });
+
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+
+    while (!delivering) {
+        std::this_thread::yield();
+    }
+
+    // Destroying the broker of an expired stage does not wait for the
+    // delivery thread and drops pending notices.
+    broker.Reset();
+    stage.Reset();
+    unf::Broker::ResetAll();
+
+    lock.unlock();
+
+    while (received == 0) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(received, 1);
+}
+
+TEST_F(BrokerFlowTest, DebounceQuietPeriod)
+{
+    using namespace std::chrono;
+
+    auto broker = unf::Broker::Create(_stage);
+
+    steady_clock::time_point now;
+    auto clock = [&]() { return now; };
+
+    ASSERT_FALSE(broker->IsDebounceEnabled());
+    broker->EnableDebounce(milliseconds(100), milliseconds(1000), clock);
+    ASSERT_TRUE(broker->IsDebounceEnabled());
+
+    broker->Send<::Test::MergeableNotice>();
+    now += milliseconds(10);
+    broker->Send<::Test::MergeableNotice>();
+    now += milliseconds(10);
+    broker->Send<::Test::MergeableNotice>();
+
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+
+    // Notices are held until the quiet period elapsed.
+    now += milliseconds(50);
+    ASSERT_FALSE(broker->Poll());
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 0);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 0);
+
+    now += milliseconds(50);
+    ASSERT_TRUE(broker->Poll());
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 2);
+
+    // Notices sent after the quiet period start a new batch, and the
+    // previous batch is delivered.
+    broker->Send<::Test::MergeableNotice>();
+    now += milliseconds(200);
+    broker->Send<::Test::MergeableNotice>();
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 2);
+
+    // Pending notices are delivered when debouncing is disabled.
+    broker->DisableDebounce();
+    ASSERT_FALSE(broker->IsDebounceEnabled());
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 3);
+}
+
+TEST_F(BrokerFlowTest, DebounceMaxLatency)
+{
+    using namespace std::chrono;
+
+    auto broker = unf::Broker::Create(_stage);
+
+    steady_clock::time_point now;
+    broker->EnableDebounce(
+        milliseconds(100), milliseconds(1000), [&]() { return now; });
+
+    // Notices sent continuously are delivered once the maximum latency
+    // elapsed.
+    for (size_t i = 0; i < 21; ++i) {
+        broker->Send<::Test::MergeableNotice>();
+        now += milliseconds(50);
+    }
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+
+    broker->DisableDebounce();
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+}
+
+TEST_F(BrokerFlowTest, DebounceWithTransaction)
+{
+    using namespace std::chrono;
+
+    auto broker = unf::Broker::Create(_stage);
+
+    steady_clock::time_point now;
+    broker->EnableDebounce(
+        milliseconds(100), milliseconds(1000), [&]() { return now; });
+
+    std::vector<std::string> received;
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+    observer.SetCallback([&](const ::Test::MergeableNotice& notice) {
+        received.push_back(notice.GetData().begin()->second);
+    });
+
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Foo", "Test1"}}));
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Foo", "Test2"}}));
+    broker->EndTransaction();
+
+    // Pending notices are delivered before the transaction notices.
+    ASSERT_EQ(received, std::vector<std::string>({"Test1", "Test2"}));
+
+    broker->DisableDebounce();
+}
+
 TEST_F(BrokerFlowTest, MergeableNotice)
 {
     auto broker = unf::Broker::Create(_stage);
@@ -138,6 +651,101 @@ TEST_F(BrokerFlowTest, MergeableNotice)
         n.GetData(), ::Test::DataMap({{"Foo", "Test2"}, {"Bar", "Test3"}}));
 }
 
+TEST_F(BrokerFlowTest, MergeOnCapture)
+{
+    auto broker = unf::Broker::Create(_stage);
+    ASSERT_FALSE(broker->GetMergeOnCapture());
+
+    broker->SetMergeOnCapture(true);
+    ASSERT_TRUE(broker->GetMergeOnCapture());
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+
+    broker->BeginTransaction();
+
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Foo", "Test1"}}));
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Foo", "Test2"}}));
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Bar", "Test3"}}));
+
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+
+    // No notices are emitted during a transaction.
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 0);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 0);
+
+    broker->EndTransaction();
+
+    // Result is identical to notices consolidated at the end of transaction.
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 3);
+
+    const auto& n = observer.GetLatestNotice();
+    ASSERT_EQ(
+        n.GetData(), ::Test::DataMap({{"Foo", "Test2"}, {"Bar", "Test3"}}));
+}
+
+TEST_F(BrokerFlowTest, MergeOnCaptureNested)
+{
+    auto broker = unf::Broker::Create(_stage);
+    broker->SetMergeOnCapture(true);
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Foo", "Test1"}}));
+    broker->Send<::Test::UnMergeableNotice>();
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Foo", "Test2"}}));
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap({{"Bar", "Test3"}}));
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    // No notices are emitted while at least one transaction is started.
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 0);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 0);
+
+    broker->EndTransaction();
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 2);
+
+    const auto& n = observer.GetLatestNotice();
+    ASSERT_EQ(
+        n.GetData(), ::Test::DataMap({{"Foo", "Test2"}, {"Bar", "Test3"}}));
+}
+
+TEST_F(BrokerFlowTest, ParallelMerge)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    ::Test::Observer<::Test::MergeableNotice> observer(_stage);
+
+    // Send enough notices for types to be merged concurrently.
+    const size_t count = 1000;
+
+    broker->BeginTransaction();
+
+    for (size_t i = 0; i < count; ++i) {
+        const std::string key = "Foo" + std::to_string(i);
+        broker->Send<::Test::MergeableNotice>(::Test::DataMap({{key, "Test"}}));
+        broker->Send<::Test::UnMergeableNotice>();
+    }
+
+    broker->EndTransaction();
+
+    // Result is identical to notices merged sequentially.
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 1);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), count);
+
+    const auto& n = observer.GetLatestNotice();
+    ASSERT_EQ(n.GetData().size(), count);
+    ASSERT_EQ(n.GetData().at("Foo0"), "Test");
+    ASSERT_EQ(n.GetData().at("Foo999"), "Test");
+}
+
 TEST_F(BrokerFlowTest, WithFilter)
 {
     auto broker = unf::Broker::Create(_stage);
@@ -230,3 +838,193 @@ TEST_F(BrokerFlowTest, WithBlockAllPredicate)
     ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 0);
     ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 0);
 }
+
+TEST_F(BrokerFlowTest, Statistics)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    // Return counters recorded for a notice type.
+    auto getStatistics = [](const unf::BrokerStatistics& statistics,
+                            const std::string& typeName) {
+        for (const auto& notice : statistics.notices) {
+            if (notice.typeName == typeName) {
+                return notice;
+            }
+        }
+        return unf::NoticeStatistics();
+    };
+
+    // Times are not recorded by default.
+    ASSERT_FALSE(broker->GetTimeTracking());
+
+    broker->Send<::Test::MergeableNotice>();
+
+    auto statistics = broker->GetStatistics();
+    ASSERT_EQ(statistics.notices.size(), 1);
+    ASSERT_EQ(statistics.sendTime.count(), 0);
+
+    broker->ResetStatistics();
+    broker->SetTimeTracking(true);
+    ASSERT_TRUE(broker->GetTimeTracking());
+
+    broker->Send<::Test::MergeableNotice>();
+
+    // Filter out UnMergeableNotice type.
+    broker->BeginTransaction(
+        unf::CapturePredicate::ExcludeTypes<::Test::UnMergeableNotice>());
+
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+
+    broker->EndTransaction();
+
+    statistics = broker->GetStatistics();
+    ASSERT_EQ(statistics.notices.size(), 2);
+
+    auto mergeable = getStatistics(statistics, "Test::MergeableNotice");
+    ASSERT_EQ(mergeable.received, 4);
+    ASSERT_EQ(mergeable.captured, 3);
+    ASSERT_EQ(mergeable.filtered, 0);
+    ASSERT_EQ(mergeable.merged, 2);
+    ASSERT_EQ(mergeable.sent, 2);
+
+    auto unmergeable = getStatistics(statistics, "Test::UnMergeableNotice");
+    ASSERT_EQ(unmergeable.received, 2);
+    ASSERT_EQ(unmergeable.captured, 0);
+    ASSERT_EQ(unmergeable.filtered, 2);
+    ASSERT_EQ(unmergeable.merged, 0);
+    ASSERT_EQ(unmergeable.sent, 0);
+
+    ASSERT_GT(statistics.captureTime.count(), 0);
+    ASSERT_GT(statistics.sendTime.count(), 0);
+
+    broker->ResetStatistics();
+
+    statistics = broker->GetStatistics();
+    ASSERT_EQ(statistics.notices.size(), 0);
+    ASSERT_EQ(statistics.captureTime.count(), 0);
+    ASSERT_EQ(statistics.mergeTime.count(), 0);
+    ASSERT_EQ(statistics.postProcessTime.count(), 0);
+    ASSERT_EQ(statistics.sendTime.count(), 0);
+}
+
+TEST_F(BrokerFlowTest, LatencyTracking)
+{
+    auto broker = unf::Broker::Create(_stage);
+    ASSERT_FALSE(broker->GetLatencyTracking());
+
+    broker->SetLatencyTracking(true);
+    ASSERT_TRUE(broker->GetLatencyTracking());
+
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+
+    broker->BeginTransaction();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    broker->SetLatencyTracking(false);
+    ASSERT_FALSE(broker->GetLatencyTracking());
+
+    // Notices sent once tracking is disabled are not recorded.
+    broker->Send<::Test::MergeableNotice>();
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 4);
+    ASSERT_EQ(_listener.Received<::Test::UnMergeableNotice>(), 2);
+
+    // Latencies are recorded for the delivery of each notice to all
+    // listeners, and for each listener.
+    std::unordered_map<std::string, uint64_t> sends;
+    std::unordered_map<std::string, uint64_t> deliveries;
+
+    auto statistics = broker->GetStatistics();
+    for (const auto& latency : statistics.latencies) {
+        ASSERT_LE(latency.p50, latency.p99);
+        ASSERT_LE(latency.p99, latency.max);
+
+        if (latency.listenerName.empty()) {
+            sends[latency.typeName] += latency.count;
+        }
+        else {
+            deliveries[latency.typeName] += latency.count;
+        }
+    }
+
+    ASSERT_EQ(sends.at("Test::MergeableNotice"), 3);
+    ASSERT_EQ(sends.at("Test::UnMergeableNotice"), 2);
+    ASSERT_EQ(deliveries.at("Test::MergeableNotice"), 3);
+    ASSERT_EQ(deliveries.at("Test::UnMergeableNotice"), 2);
+
+    broker->ResetStatistics();
+    ASSERT_EQ(broker->GetStatistics().latencies.size(), 0);
+}
+
+TEST_F(BrokerFlowTest, Recording)
+{
+    auto broker = unf::Broker::Create(_stage);
+    ASSERT_FALSE(broker->IsRecording());
+
+    const std::string filePath =
+        ::testing::TempDir() + "testBrokerFlowRecording.json";
+
+    broker->StartRecording(filePath);
+    ASSERT_TRUE(broker->IsRecording());
+
+    broker->BeginTransaction(
+        unf::CapturePredicate::ExcludeTypes<::Test::UnMergeableNotice>());
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::MergeableNotice>();
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    broker->StopRecording();
+    ASSERT_FALSE(broker->IsRecording());
+
+    std::ifstream stream(filePath);
+    ASSERT_TRUE(stream.good());
+
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    const std::string content = buffer.str();
+
+    // Return number of occurrences of text within recorded content.
+    auto count = [&](const std::string& text) {
+        size_t number = 0;
+        for (size_t pos = content.find(text); pos != std::string::npos;
+             pos = content.find(text, pos + text.size())) {
+            number++;
+        }
+        return number;
+    };
+
+    ASSERT_EQ(content.find("{\"displayTimeUnit\": \"ms\""), 0);
+    ASSERT_EQ(count("\"name\": \"Transaction\""), 2);
+    ASSERT_EQ(count("\"cat\": \"capture\""), 2);
+    ASSERT_EQ(count("\"cat\": \"filter\""), 1);
+    ASSERT_EQ(count("\"cat\": \"merge\""), 1);
+    ASSERT_EQ(count("\"notices\": 2"), 1);
+    ASSERT_EQ(count("\"cat\": \"postProcess\""), 1);
+    ASSERT_EQ(count("\"cat\": \"send\""), 1);
+    ASSERT_EQ(count("\"name\": \"Test::MergeableNotice\""), 5);
+    ASSERT_EQ(count("\"name\": \"Test::UnMergeableNotice\""), 1);
+}
+
+TEST_F(BrokerFlowTest, RecordingInvalidFile)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    PXR_NS::TfErrorMark mark;
+
+    // The error is reported when the recording starts.
+    broker->StartRecording(::testing::TempDir() + "missing/file.json");
+    ASSERT_FALSE(broker->IsRecording());
+
+    ASSERT_FALSE(mark.IsClean());
+    mark.Clear();
+}
@@ -0,0 +1,126 @@
+#include <unf/capturePredicate.h>
+#include <unf/notice.h>
+
+#include <unfTest/notice.h>
+
+#include <gtest/gtest.h>
+
+#include <typeinfo>
+
+TEST(CapturePredicateTest, Default)
+{
+    auto predicate = unf::CapturePredicate::Default();
+    ASSERT_TRUE(predicate.IsTypeBased());
+
+    ASSERT_TRUE(predicate(*::Test::MergeableNotice::Create()));
+    ASSERT_TRUE(predicate(*::Test::UnMergeableNotice::Create()));
+}
+
+TEST(CapturePredicateTest, BlockAll)
+{
+    auto predicate = unf::CapturePredicate::BlockAll();
+    ASSERT_TRUE(predicate.IsTypeBased());
+
+    ASSERT_FALSE(predicate(*::Test::MergeableNotice::Create()));
+    ASSERT_FALSE(predicate(*::Test::UnMergeableNotice::Create()));
+}
+
+TEST(CapturePredicateTest, IncludeTypes)
+{
+    auto predicate =
+        unf::CapturePredicate::IncludeTypes<::Test::MergeableNotice>();
+    ASSERT_TRUE(predicate.IsTypeBased());
+
+    ASSERT_TRUE(predicate(*::Test::MergeableNotice::Create()));
+    ASSERT_FALSE(predicate(*::Test::UnMergeableNotice::Create()));
+
+    auto output = ::Test::OutputNotice1::Create(::Test::InputNotice());
+    ASSERT_FALSE(predicate(*output));
+}
+
+TEST(CapturePredicateTest, ExcludeTypes)
+{
+    auto predicate =
+        unf::CapturePredicate::ExcludeTypes<::Test::MergeableNotice>();
+    ASSERT_TRUE(predicate.IsTypeBased());
+
+    ASSERT_FALSE(predicate(*::Test::MergeableNotice::Create()));
+    ASSERT_TRUE(predicate(*::Test::UnMergeableNotice::Create()));
+
+    auto output = ::Test::OutputNotice1::Create(::Test::InputNotice());
+    ASSERT_TRUE(predicate(*output));
+}
+
+TEST(CapturePredicateTest, TypesOutsideOfSet)
+{
+    // Key attributed after all keys used within the predicate.
+    const auto key = unf::UnfNotice::StageNotice::InternTypeKey(
+        typeid(CapturePredicateTest_TypesOutsideOfSet_Test));
+
+    auto include =
+        unf::CapturePredicate::IncludeTypes<::Test::MergeableNotice>();
+    auto exclude =
+        unf::CapturePredicate::ExcludeTypes<::Test::MergeableNotice>();
+
+    auto notice = ::Test::MergeableNotice::Create();
+    ASSERT_FALSE(include(*notice, key + 1000));
+    ASSERT_TRUE(exclude(*notice, key + 1000));
+}
+
+TEST(CapturePredicateTest, Combinators)
+{
+    using Predicate = unf::CapturePredicate;
+
+    auto mergeable = ::Test::MergeableNotice::Create();
+    auto unmergeable = ::Test::UnMergeableNotice::Create();
+    auto output = ::Test::OutputNotice1::Create(::Test::InputNotice());
+
+    auto predicate1 = Predicate::IncludeTypes<
+        ::Test::MergeableNotice, ::Test::UnMergeableNotice>();
+    auto predicate2 = Predicate::ExcludeTypes<::Test::MergeableNotice>();
+
+    // Combined type based predicates remain type based.
+    auto intersection = predicate1 & predicate2;
+    ASSERT_TRUE(intersection.IsTypeBased());
+    ASSERT_FALSE(intersection(*mergeable));
+    ASSERT_TRUE(intersection(*unmergeable));
+    ASSERT_FALSE(intersection(*output));
+
+    auto combination = predicate1 | predicate2;
+    ASSERT_TRUE(combination.IsTypeBased());
+    ASSERT_TRUE(combination(*mergeable));
+    ASSERT_TRUE(combination(*unmergeable));
+    ASSERT_TRUE(combination(*output));
+
+    auto negation = ~predicate1;
+    ASSERT_TRUE(negation.IsTypeBased());
+    ASSERT_FALSE(negation(*mergeable));
+    ASSERT_FALSE(negation(*unmergeable));
+    ASSERT_TRUE(negation(*output));
+
+    ASSERT_TRUE((~Predicate::BlockAll())(*output));
+    ASSERT_FALSE((Predicate::Default() & Predicate::BlockAll())(*output));
+}
+
+TEST(CapturePredicateTest, CombinatorsWithFunction)
+{
+    using Predicate = unf::CapturePredicate;
+
+    auto mergeable = ::Test::MergeableNotice::Create();
+    auto unmergeable = ::Test::UnMergeableNotice::Create();
+
+    auto function = Predicate([](const unf::UnfNotice::StageNotice& notice) {
+        return notice.IsMergeable();
+    });
+    ASSERT_FALSE(function.IsTypeBased());
+
+    auto predicate = function & Predicate::Default();
+    ASSERT_FALSE(predicate.IsTypeBased());
+    ASSERT_TRUE(predicate(*mergeable));
+    ASSERT_FALSE(predicate(*unmergeable));
+
+    predicate = ~function | Predicate::BlockAll();
+    ASSERT_FALSE(predicate.IsTypeBased());
+    ASSERT_FALSE(predicate(*mergeable));
+    ASSERT_TRUE(predicate(*unmergeable));
+}
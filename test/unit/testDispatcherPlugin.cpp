@@ -1,6 +1,7 @@
 #include <unf/broker.h>
 #include <unf/dispatcher.h>
 
+#include <unfTest/createBrokerDispatcher/dispatcher.h>
 #include <unfTest/listener.h>
 #include <unfTest/notice.h>
 #include <unfTest/newDispatcher/dispatcher.h>
@@ -11,6 +12,8 @@
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <vector>
+
 class DispatcherTest : public ::testing::Test {
   protected:
     using StageDispatcherPtr = PXR_NS::TfRefPtr<unf::StageDispatcher>;
@@ -45,3 +48,31 @@ TEST_F(DispatcherTest, Discover)
     ASSERT_EQ(_listener.Received<::Test::OutputNotice1>(), 1);
     ASSERT_EQ(_listener.Received<::Test::OutputNotice2>(), 1);
 }
+
+TEST_F(DispatcherTest, CreateBrokerFromDispatcher)
+{
+    // Enough stages are used for some of them to share the registry shard
+    // of the stage.
+    const size_t stageCount = 1000;
+
+    std::vector<PXR_NS::UsdStageRefPtr> stages;
+    for (size_t i = 0; i < stageCount; ++i) {
+        stages.push_back(PXR_NS::UsdStage::CreateInMemory());
+        ::Test::CreateBrokerDispatcher::GetStages().push_back(stages.back());
+    }
+
+    // Brokers are created for each stage when the dispatcher is registered
+    // by the new broker.
+    auto broker = unf::Broker::Create(_stage);
+    ASSERT_EQ(unf::Broker::Create(_stage), broker);
+
+    auto brokers = ::Test::CreateBrokerDispatcher::GetBrokers();
+    ::Test::CreateBrokerDispatcher::GetStages().clear();
+    ::Test::CreateBrokerDispatcher::GetBrokers().clear();
+
+    ASSERT_EQ(brokers.size(), stageCount);
+    for (size_t i = 0; i < stageCount; ++i) {
+        ASSERT_TRUE(brokers[i]);
+        ASSERT_EQ(unf::Broker::Create(stages[i]), brokers[i]);
+    }
+}
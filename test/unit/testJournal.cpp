@@ -0,0 +1,160 @@
+#include <unf/broker.h>
+#include <unf/journal.h>
+
+#include <unfTest/listener.h>
+#include <unfTest/notice.h>
+
+#include <gtest/gtest.h>
+#include <pxr/base/tf/errorMark.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+class JournalTest : public ::testing::Test {
+  protected:
+    using Listener =
+        ::Test::Listener<::Test::MergeableNotice, ::Test::UnMergeableNotice>;
+
+    void SetUp() override
+    {
+        _stage = PXR_NS::UsdStage::CreateInMemory();
+        _listener.SetStage(_stage);
+    }
+
+    // Return all entries read from journal at filePath.
+    static std::vector<unf::JournalEntry> Read(const std::string& filePath)
+    {
+        std::vector<unf::JournalEntry> entries;
+
+        unf::JournalReader reader(filePath);
+        EXPECT_TRUE(reader.IsValid());
+
+        unf::JournalEntry entry;
+        while (reader.Read(entry)) {
+            entries.push_back(entry);
+        }
+
+        EXPECT_TRUE(reader.IsValid());
+        return entries;
+    }
+
+    // Return data of the MergeableNotice recorded in entry.
+    static const ::Test::DataMap& GetData(const unf::JournalEntry& entry)
+    {
+        return dynamic_cast<::Test::MergeableNotice&>(*entry.notice)
+            .GetData();
+    }
+
+    PXR_NS::UsdStageRefPtr _stage;
+    Listener _listener;
+};
+
+TEST_F(JournalTest, Emitted)
+{
+    auto broker = unf::Broker::Create(_stage);
+    ASSERT_FALSE(broker->IsJournaling());
+
+    const std::string filePath =
+        ::testing::TempDir() + "testJournalEmitted.unfj";
+
+    broker->StartJournal(filePath);
+    ASSERT_TRUE(broker->IsJournaling());
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap{{"Foo", "Test1"}});
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap{{"Bar", "Test2"}});
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap{{"Foo", "Test3"}});
+
+    broker->StopJournal();
+    ASSERT_FALSE(broker->IsJournaling());
+
+    // Notices which cannot be serialized are not recorded.
+    const auto entries = Read(filePath);
+    ASSERT_EQ(entries.size(), 2);
+
+    ASSERT_EQ(entries[0].type, unf::JournalEntryType::Notice);
+    ASSERT_EQ(
+        GetData(entries[0]),
+        (::Test::DataMap{{"Foo", "Test1"}, {"Bar", "Test2"}}));
+
+    ASSERT_EQ(entries[1].type, unf::JournalEntryType::Notice);
+    ASSERT_EQ(GetData(entries[1]), (::Test::DataMap{{"Foo", "Test3"}}));
+
+    ASSERT_LE(entries[0].time, entries[1].time);
+}
+
+TEST_F(JournalTest, Captured)
+{
+    auto broker = unf::Broker::Create(_stage);
+
+    const std::string filePath =
+        ::testing::TempDir() + "testJournalCaptured.unfj";
+
+    broker->StartJournal(filePath, unf::JournalMode::Captured);
+
+    broker->BeginTransaction();
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap{{"Foo", "Test1"}});
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap{{"Bar", "Test2"}});
+    broker->Send<::Test::UnMergeableNotice>();
+    broker->EndTransaction();
+
+    broker->Send<::Test::MergeableNotice>(::Test::DataMap{{"Foo", "Test3"}});
+
+    broker->StopJournal();
+
+    const auto entries = Read(filePath);
+    ASSERT_EQ(entries.size(), 5);
+
+    ASSERT_EQ(entries[0].type, unf::JournalEntryType::BeginTransaction);
+    ASSERT_EQ(entries[1].type, unf::JournalEntryType::Notice);
+    ASSERT_EQ(GetData(entries[1]), (::Test::DataMap{{"Foo", "Test1"}}));
+    ASSERT_EQ(entries[2].type, unf::JournalEntryType::Notice);
+    ASSERT_EQ(GetData(entries[2]), (::Test::DataMap{{"Bar", "Test2"}}));
+    ASSERT_EQ(entries[3].type, unf::JournalEntryType::EndTransaction);
+    ASSERT_EQ(entries[4].type, unf::JournalEntryType::Notice);
+    ASSERT_EQ(GetData(entries[4]), (::Test::DataMap{{"Foo", "Test3"}}));
+
+    // Replaying the journal reproduces the transaction.
+    _listener.Reset();
+
+    for (const auto& entry : entries) {
+        if (entry.type == unf::JournalEntryType::Notice) {
+            broker->Send(entry.notice);
+        }
+        else if (entry.type == unf::JournalEntryType::BeginTransaction) {
+            broker->BeginTransaction();
+        }
+        else {
+            broker->EndTransaction();
+        }
+    }
+
+    ASSERT_EQ(_listener.Received<::Test::MergeableNotice>(), 2);
+}
+
+TEST_F(JournalTest, InvalidFile)
+{
+    const std::string filePath =
+        ::testing::TempDir() + "testJournalInvalidFile.unfj";
+
+    {
+        std::ofstream stream(filePath);
+        stream << "{}";
+    }
+
+    PXR_NS::TfErrorMark mark;
+
+    unf::JournalReader reader(filePath);
+    ASSERT_FALSE(reader.IsValid());
+
+    unf::JournalEntry entry;
+    ASSERT_FALSE(reader.Read(entry));
+
+    ASSERT_FALSE(mark.IsClean());
+    mark.Clear();
+}
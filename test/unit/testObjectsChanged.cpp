@@ -12,6 +12,9 @@
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <string>
+#include <vector>
+
 class ObjectsChangedTest : public ::testing::Test {
   protected:
     void SetUp() override
@@ -59,6 +62,25 @@ TEST_F(ObjectsChangedTest, ChangedInfoOnly)
     ASSERT_TRUE(n.AffectedObject(prim2));
 }
 
+TEST_F(ObjectsChangedTest, ResyncedObjectDescendant)
+{
+    ::Test::Observer<unf::UnfNotice::ObjectsChanged> observer(_stage);
+
+    _stage->DefinePrim(PXR_NS::SdfPath{"/Foo"});
+
+    ASSERT_EQ(observer.Received(), 1);
+
+    // Descendants of resynced paths are also resynced.
+    const auto& n = observer.GetLatestNotice();
+    ASSERT_TRUE(n.ResyncedObject(PXR_NS::SdfPath{"/Foo"}));
+    ASSERT_TRUE(n.ResyncedObject(PXR_NS::SdfPath{"/Foo/Bar/Baz"}));
+    ASSERT_TRUE(n.ResyncedObject(PXR_NS::SdfPath{"/Foo.attr"}));
+    ASSERT_FALSE(n.ResyncedObject(PXR_NS::SdfPath{"/Bar"}));
+    ASSERT_FALSE(n.ResyncedObject(PXR_NS::SdfPath{"/Food"}));
+    ASSERT_TRUE(n.AffectedObject(PXR_NS::SdfPath{"/Foo/Bar"}));
+    ASSERT_FALSE(n.AffectedObject(PXR_NS::SdfPath{"/Bar"}));
+}
+
 TEST_F(ObjectsChangedTest, GetResyncedPaths)
 {
     ::Test::Observer<unf::UnfNotice::ObjectsChanged> observer(_stage);
@@ -271,6 +293,12 @@ TEST_F(ObjectsChangedTest, MergingChangeInfoMultiple)
     ASSERT_EQ(
         n.GetChangedFields(PXR_NS::SdfPath{"/Bim"}),
         unf::TfTokenSet{PXR_NS::TfToken{"comment"}});
+
+    // Ensure that all merged paths can be queried.
+    ASSERT_TRUE(n.ChangedInfoOnly(prim1));
+    ASSERT_TRUE(n.ChangedInfoOnly(prim2));
+    ASSERT_TRUE(n.ChangedInfoOnly(prim3));
+    ASSERT_FALSE(n.ResyncedObject(prim3));
 }
 
 TEST_F(ObjectsChangedTest, MergingResyncAndChangeInfo)
@@ -301,3 +329,50 @@ TEST_F(ObjectsChangedTest, MergingResyncAndChangeInfo)
     ASSERT_NE(tokens.find(PXR_NS::TfToken{"specifier"}), tokens.end());
     ASSERT_NE(tokens.find(PXR_NS::TfToken{"typeName"}), tokens.end());
 }
+
+TEST_F(ObjectsChangedTest, MergingLargeTransaction)
+{
+    const size_t size = 3000;
+
+    std::vector<PXR_NS::UsdPrim> prims;
+    for (size_t i = 0; i < size; ++i) {
+        prims.push_back(_stage->DefinePrim(
+            PXR_NS::SdfPath{"/Foo" + std::to_string(i)}));
+    }
+
+    ::Test::Observer<unf::UnfNotice::ObjectsChanged> observer(_stage);
+
+    // Record enough notices for the merge to be performed with a parallel
+    // reduction.
+    _broker->BeginTransaction();
+    for (size_t i = 0; i < size; ++i) {
+        prims[i].SetMetadata(PXR_NS::TfToken{"comment"}, "This is a test");
+
+        if (i == size / 2) {
+            _stage->DefinePrim(
+                PXR_NS::SdfPath{"/Foo0"}, PXR_NS::TfToken("Cylinder"));
+        }
+    }
+    _broker->EndTransaction();
+
+    ASSERT_EQ(observer.Received(), 1);
+
+    // Ensure that the result is identical to merging notices sequentially:
+    // modified paths recorded before the resync are kept.
+    const auto& n = observer.GetLatestNotice();
+    ASSERT_EQ(
+        n.GetResyncedPaths(), PXR_NS::SdfPathVector{PXR_NS::SdfPath{"/Foo0"}});
+
+    const auto& paths = n.GetChangedInfoOnlyPaths();
+    ASSERT_EQ(paths.size(), size);
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(paths.at(i), prims[i].GetPath());
+    }
+
+    ASSERT_TRUE(n.ResyncedObject(prims[0]));
+    ASSERT_TRUE(n.ChangedInfoOnly(prims[0]));
+
+    ASSERT_EQ(
+        n.GetChangedFields(prims[size - 1]),
+        unf::TfTokenSet{PXR_NS::TfToken{"comment"}});
+}
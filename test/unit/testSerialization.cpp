@@ -0,0 +1,273 @@
+#include <unf/broker.h>
+#include <unf/notice.h>
+#include <unf/serialization.h>
+
+#include <unfTest/notice.h>
+#include <unfTest/observer.h>
+
+#include <gtest/gtest.h>
+#include <pxr/base/tf/errorMark.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST(SerializationTest, Varint)
+{
+    const std::vector<uint64_t> values = {
+        0, 1, 127, 128, 300, 16383, 16384, UINT32_MAX, UINT64_MAX};
+
+    unf::NoticeWriter writer;
+    for (const auto& value : values) {
+        writer.WriteVarint(value);
+    }
+
+    // Small values are encoded on a single byte.
+    unf::NoticeWriter smallWriter;
+    smallWriter.WriteVarint(127);
+    ASSERT_EQ(smallWriter.GetData().size(), 1);
+
+    unf::NoticeReader reader(writer.TakeData());
+    for (const auto& value : values) {
+        ASSERT_EQ(reader.ReadVarint(), value);
+    }
+
+    ASSERT_TRUE(reader.AtEnd());
+    ASSERT_TRUE(reader.IsValid());
+    ASSERT_TRUE(writer.GetData().empty());
+}
+
+TEST(SerializationTest, StringTable)
+{
+    unf::NoticeWriter writer;
+
+    writer.WriteString("foo");
+    const size_t size = writer.GetData().size();
+
+    // Strings already written are only encoded with their index.
+    writer.WriteString("foo");
+    ASSERT_EQ(writer.GetData().size(), size + 1);
+
+    writer.WriteToken(PXR_NS::TfToken("bar"));
+    writer.WriteString("");
+    writer.WriteToken(PXR_NS::TfToken("foo"));
+
+    unf::NoticeReader reader(writer.TakeData());
+    ASSERT_EQ(reader.ReadString(), "foo");
+    ASSERT_EQ(reader.ReadString(), "foo");
+    ASSERT_EQ(reader.ReadToken(), PXR_NS::TfToken("bar"));
+    ASSERT_EQ(reader.ReadString(), "");
+    ASSERT_EQ(reader.ReadToken(), PXR_NS::TfToken("foo"));
+
+    ASSERT_TRUE(reader.AtEnd());
+    ASSERT_TRUE(reader.IsValid());
+}
+
+TEST(SerializationTest, PathTable)
+{
+    const PXR_NS::SdfPathVector paths = {
+        PXR_NS::SdfPath("/Foo/Bar/Baz"),
+        PXR_NS::SdfPath("/Foo/Bar/Baz.attr"),
+        PXR_NS::SdfPath("/Foo/Bar{variant=selection}Child"),
+        PXR_NS::SdfPath("/Foo/Bar"),
+        PXR_NS::SdfPath("Relative/Path"),
+        PXR_NS::SdfPath::AbsoluteRootPath(),
+        PXR_NS::SdfPath::EmptyPath(),
+    };
+
+    unf::NoticeWriter writer;
+    writer.WritePaths(paths);
+
+    // Paths already written are only encoded with their index.
+    const size_t size = writer.GetData().size();
+    writer.WritePath(PXR_NS::SdfPath("/Foo/Bar/Baz"));
+    ASSERT_EQ(writer.GetData().size(), size + 1);
+
+    unf::NoticeReader reader(writer.TakeData());
+    ASSERT_EQ(reader.ReadPaths(), paths);
+    ASSERT_EQ(reader.ReadPath(), PXR_NS::SdfPath("/Foo/Bar/Baz"));
+
+    ASSERT_TRUE(reader.AtEnd());
+    ASSERT_TRUE(reader.IsValid());
+}
+
+TEST(SerializationTest, Stream)
+{
+    unf::NoticeWriter writer;
+    unf::NoticeReader reader;
+
+    // Tables are preserved between chunks of data.
+    writer.WritePath(PXR_NS::SdfPath("/Foo/Bar"));
+    reader.Append(writer.TakeData());
+    ASSERT_EQ(reader.ReadPath(), PXR_NS::SdfPath("/Foo/Bar"));
+
+    writer.WritePath(PXR_NS::SdfPath("/Foo/Bar"));
+    ASSERT_EQ(writer.GetData().size(), 1);
+
+    reader.Append(writer.TakeData());
+    ASSERT_EQ(reader.ReadPath(), PXR_NS::SdfPath("/Foo/Bar"));
+
+    ASSERT_TRUE(reader.AtEnd());
+    ASSERT_TRUE(reader.IsValid());
+}
+
+TEST(SerializationTest, ObjectsChanged)
+{
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+
+    auto prim = stage->DefinePrim(PXR_NS::SdfPath{"/Foo"});
+
+    ::Test::Observer<unf::UnfNotice::ObjectsChanged> observer(stage);
+
+    broker->BeginTransaction();
+    stage->DefinePrim(PXR_NS::SdfPath{"/Bar"});
+    prim.SetMetadata(PXR_NS::TfToken("comment"), "test");
+    broker->EndTransaction();
+
+    ASSERT_EQ(observer.Received(), 1);
+
+    const auto& notice = observer.GetLatestNotice();
+
+    unf::NoticeWriter writer;
+    ASSERT_TRUE(unf::SerializeNotice(notice, writer));
+
+    unf::NoticeReader reader(writer.TakeData());
+    auto _notice = unf::DeserializeNotice(reader);
+    ASSERT_TRUE(_notice);
+    ASSERT_TRUE(reader.AtEnd());
+
+    using _Notice = unf::UnfNotice::ObjectsChanged;
+    auto& result = dynamic_cast<_Notice&>(*_notice);
+
+    ASSERT_EQ(result.GetResyncedPaths(), notice.GetResyncedPaths());
+    ASSERT_EQ(
+        result.GetChangedInfoOnlyPaths(), notice.GetChangedInfoOnlyPaths());
+    ASSERT_EQ(result.GetChangedFieldMap(), notice.GetChangedFieldMap());
+
+    // Indexes are rebuilt for queries.
+    ASSERT_TRUE(result.ResyncedObject(PXR_NS::SdfPath{"/Bar"}));
+    ASSERT_TRUE(result.ChangedInfoOnly(PXR_NS::SdfPath{"/Foo"}));
+    ASSERT_FALSE(result.ResyncedObject(PXR_NS::SdfPath{"/Foo"}));
+}
+
+TEST(SerializationTest, LayerMutingChanged)
+{
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+
+    const std::vector<std::string> muted = {"foo.usda", "bar.usda"};
+    const std::vector<std::string> unmuted = {"baz.usda"};
+
+    PXR_NS::UsdNotice::LayerMutingChanged original(stage, muted, unmuted);
+    auto notice = unf::UnfNotice::LayerMutingChanged::Create(original);
+
+    unf::NoticeWriter writer;
+    ASSERT_TRUE(unf::SerializeNotice(*notice, writer));
+
+    unf::NoticeReader reader(writer.TakeData());
+    auto _notice = unf::DeserializeNotice(reader);
+    ASSERT_TRUE(_notice);
+
+    using _Notice = unf::UnfNotice::LayerMutingChanged;
+    auto& result = dynamic_cast<_Notice&>(*_notice);
+
+    ASSERT_EQ(result.GetMutedLayers(), muted);
+    ASSERT_EQ(result.GetUnmutedLayers(), unmuted);
+}
+
+TEST(SerializationTest, CustomNotice)
+{
+    auto notice1 = ::Test::MergeableNotice::Create(
+        ::Test::DataMap{{"Foo", "Test1"}, {"Bar", "Test2"}});
+    auto notice2 = ::Test::MergeableNotice::Create(
+        ::Test::DataMap{{"Foo", "Test3"}});
+
+    unf::NoticeWriter writer;
+    ASSERT_TRUE(unf::SerializeNotice(*notice1, writer));
+    ASSERT_TRUE(unf::SerializeNotice(*notice2, writer));
+
+    unf::NoticeReader reader(writer.TakeData());
+
+    auto result1 = unf::DeserializeNotice(reader);
+    ASSERT_TRUE(result1);
+    ASSERT_EQ(
+        dynamic_cast<::Test::MergeableNotice&>(*result1).GetData(),
+        notice1->GetData());
+
+    auto result2 = unf::DeserializeNotice(reader);
+    ASSERT_TRUE(result2);
+    ASSERT_EQ(
+        dynamic_cast<::Test::MergeableNotice&>(*result2).GetData(),
+        notice2->GetData());
+
+    ASSERT_TRUE(reader.AtEnd());
+}
+
+TEST(SerializationTest, UnsupportedNotice)
+{
+    auto notice = ::Test::UnMergeableNotice::Create();
+
+    // Notice types defined without serializer are not written.
+    unf::NoticeWriter writer;
+    ASSERT_FALSE(unf::SerializeNotice(*notice, writer));
+    ASSERT_TRUE(writer.GetData().empty());
+}
+
+TEST(SerializationTest, UnknownNotice)
+{
+    unf::NoticeWriter writer;
+    writer.WriteString("Unknown");
+
+    PXR_NS::TfErrorMark mark;
+
+    unf::NoticeReader reader(writer.TakeData());
+    ASSERT_FALSE(unf::DeserializeNotice(reader));
+
+    ASSERT_FALSE(mark.IsClean());
+    mark.Clear();
+}
+
+TEST(SerializationTest, TruncatedData)
+{
+    auto notice = ::Test::MergeableNotice::Create(
+        ::Test::DataMap{{"Foo", "Test1"}});
+
+    unf::NoticeWriter writer;
+    ASSERT_TRUE(unf::SerializeNotice(*notice, writer));
+
+    std::string data = writer.TakeData();
+    data.pop_back();
+
+    PXR_NS::TfErrorMark mark;
+
+    unf::NoticeReader reader(data);
+    ASSERT_FALSE(unf::DeserializeNotice(reader));
+    ASSERT_FALSE(reader.IsValid());
+
+    ASSERT_FALSE(mark.IsClean());
+    mark.Clear();
+}
+
+TEST(SerializationTest, DeepPathChain)
+{
+    // Each path definition refers to a parent path defined right after it,
+    // so that the chain is only bounded by the size of the data.
+    unf::NoticeWriter writer;
+    for (uint64_t index = 3; index < 1000000; ++index) {
+        writer.WriteVarint(index);
+    }
+
+    PXR_NS::TfErrorMark mark;
+
+    unf::NoticeReader reader(writer.TakeData());
+    ASSERT_TRUE(reader.ReadPath().IsEmpty());
+    ASSERT_FALSE(reader.IsValid());
+
+    ASSERT_FALSE(mark.IsClean());
+    mark.Clear();
+}
@@ -0,0 +1,40 @@
+#include <unf/notice.h>
+
+#include <unfTest/notice.h>
+
+#include <gtest/gtest.h>
+
+#include <typeinfo>
+
+TEST(StageNoticeTest, GetTypeKey)
+{
+    auto notice1 = ::Test::MergeableNotice::Create();
+    auto notice2 = ::Test::MergeableNotice::Create();
+    auto notice3 = ::Test::UnMergeableNotice::Create();
+
+    // Notices with identical types share the same key.
+    ASSERT_EQ(notice1->GetTypeKey(), notice2->GetTypeKey());
+    ASSERT_EQ(
+        notice1->GetTypeKey(), ::Test::MergeableNotice::StaticTypeKey());
+
+    // Notices with different types have distinct keys.
+    ASSERT_NE(notice1->GetTypeKey(), notice3->GetTypeKey());
+    ASSERT_EQ(
+        notice3->GetTypeKey(), ::Test::UnMergeableNotice::StaticTypeKey());
+}
+
+TEST(StageNoticeTest, InternTypeKey)
+{
+    const auto key1 =
+        unf::UnfNotice::StageNotice::InternTypeKey(typeid(::Test::InputNotice));
+    const auto key2 =
+        unf::UnfNotice::StageNotice::InternTypeKey(typeid(::Test::InputNotice));
+
+    // Interning the same type several times returns the same key.
+    ASSERT_EQ(key1, key2);
+
+    ASSERT_EQ(
+        unf::UnfNotice::StageNotice::InternTypeKey(
+            typeid(::Test::OutputNotice1)),
+        ::Test::OutputNotice1::StaticTypeKey());
+}
@@ -0,0 +1,42 @@
+#include "dispatcher.h"
+
+#include <unf/broker.h>
+#include <unf/dispatcher.h>
+
+#include <pxr/pxr.h>
+
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+TF_REGISTRY_FUNCTION(TfType)
+{
+    unf::DispatcherDefine<::Test::CreateBrokerDispatcher, unf::Dispatcher>();
+}
+
+void ::Test::CreateBrokerDispatcher::Register()
+{
+    // Brokers created here register this dispatcher as well.
+    thread_local bool registering = false;
+    if (registering) {
+        return;
+    }
+
+    registering = true;
+    for (const auto& stage : GetStages()) {
+        GetBrokers().push_back(unf::Broker::Create(stage));
+    }
+    registering = false;
+}
+
+std::vector<UsdStageWeakPtr>& ::Test::CreateBrokerDispatcher::GetStages()
+{
+    static std::vector<UsdStageWeakPtr> stages;
+    return stages;
+}
+
+std::vector<unf::BrokerPtr>& ::Test::CreateBrokerDispatcher::GetBrokers()
+{
+    static std::vector<unf::BrokerPtr> brokers;
+    return brokers;
+}
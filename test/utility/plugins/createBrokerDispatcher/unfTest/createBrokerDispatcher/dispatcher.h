@@ -0,0 +1,39 @@
+#ifndef TEST_USD_NOTICE_FRAMEWORK_PLUGIN_CREATE_BROKER_DISPATCHER_H
+#define TEST_USD_NOTICE_FRAMEWORK_PLUGIN_CREATE_BROKER_DISPATCHER_H
+
+#include <unf/api.h>
+#include <unf/broker.h>
+#include <unf/dispatcher.h>
+
+#include <pxr/usd/usd/common.h>
+
+#include <vector>
+
+namespace Test {
+
+// Dispatcher creating brokers for other stages when it is registered.
+class CreateBrokerDispatcher : public unf::Dispatcher {
+  public:
+    UNF_API CreateBrokerDispatcher(const unf::BrokerWeakPtr& broker)
+        : unf::Dispatcher(broker)
+    {
+    }
+
+    UNF_API std::string GetIdentifier() const
+    {
+        return "CreateBrokerDispatcher";
+    };
+
+    UNF_API void Register() override;
+
+    // Stages for which brokers are created when the dispatcher is
+    // registered.
+    UNF_API static std::vector<PXR_NS::UsdStageWeakPtr>& GetStages();
+
+    // Brokers created when the dispatcher has been registered.
+    UNF_API static std::vector<unf::BrokerPtr>& GetBrokers();
+};
+
+}  // namespace Test
+
+#endif  // TEST_USD_NOTICE_FRAMEWORK_PLUGIN_CREATE_BROKER_DISPATCHER_H
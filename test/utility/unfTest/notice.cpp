@@ -1,10 +1,13 @@
 #include "notice.h"
 
 #include <unf/notice.h>
+#include <unf/serialization.h>
 
 #include <pxr/base/tf/notice.h>
 #include <pxr/pxr.h>
 
+#include <cstdint>
+#include <string>
 #include <utility>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -13,8 +16,7 @@ namespace Test {
 
 TF_REGISTRY_FUNCTION(TfType)
 {
-    TfType::
-        Define<MergeableNotice, TfType::Bases<unf::UnfNotice::StageNotice> >();
+    unf::NoticeSerializerDefine<MergeableNotice, unf::UnfNotice::StageNotice>();
 
     TfType::Define<
         UnMergeableNotice,
@@ -52,6 +54,29 @@ void MergeableNotice::Merge(MergeableNotice&& notice)
 
 const DataMap& MergeableNotice::GetData() const { return _data; }
 
+void MergeableNotice::Serialize(unf::NoticeWriter& writer) const
+{
+    writer.WriteVarint(_data.size());
+    for (const auto& it : _data) {
+        writer.WriteString(it.first);
+        writer.WriteString(it.second);
+    }
+}
+
+TfRefPtr<MergeableNotice> MergeableNotice::Deserialize(
+    unf::NoticeReader& reader)
+{
+    DataMap data;
+
+    const uint64_t size = reader.ReadVarint();
+    for (uint64_t i = 0; i < size && reader.IsValid(); ++i) {
+        std::string key = reader.ReadString();
+        data[key] = reader.ReadString();
+    }
+
+    return Create(data);
+}
+
 bool UnMergeableNotice::IsMergeable() const { return false; }
 
 InputNotice::InputNotice() {}
@@ -34,6 +34,11 @@ class MergeableNotice
 
     UNF_API const DataMap& GetData() const;
 
+    UNF_API virtual void Serialize(unf::NoticeWriter& writer) const override;
+
+    UNF_API static PXR_NS::TfRefPtr<MergeableNotice> Deserialize(
+        unf::NoticeReader& reader);
+
   private:
     DataMap _data;
 };
@@ -0,0 +1,257 @@
+#include <unf/broker.h>
+#include <unf/journal.h>
+#include <unf/notice.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char* Usage =
+    "Usage: unf_replay [options] <journal>\n"
+    "\n"
+    "Replay notices recorded in a journal against the broker of an in-memory\n"
+    "stage and report throughput.\n"
+    "\n"
+    "Options:\n"
+    "  --speed <original|max>  Replay entries at their original pace or as\n"
+    "                          fast as possible. Default is max.\n"
+    "  --repeat <count>        Number of times the journal is replayed.\n"
+    "                          Default is 1.\n"
+    "  --latency               Report delivery latencies per notice type and\n"
+    "                          listener.\n"
+    "  -h, --help              Display this help.\n";
+
+struct Options {
+    std::string filePath;
+    bool originalSpeed = false;
+    size_t repeat = 1;
+    bool latency = false;
+};
+
+// Parse command line arguments into options. Return false if arguments are
+// invalid.
+bool ParseArguments(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+
+        if (argument == "--speed" && i + 1 < argc) {
+            const std::string value = argv[++i];
+            if (value != "original" && value != "max") {
+                return false;
+            }
+            options.originalSpeed = value == "original";
+        }
+        else if (argument == "--repeat" && i + 1 < argc) {
+            const long value = std::strtol(argv[++i], nullptr, 10);
+            if (value <= 0) {
+                return false;
+            }
+            options.repeat = static_cast<size_t>(value);
+        }
+        else if (argument == "--latency") {
+            options.latency = true;
+        }
+        else if (argument.empty() || argument[0] == '-') {
+            return false;
+        }
+        else if (options.filePath.empty()) {
+            options.filePath = argument;
+        }
+        else {
+            return false;
+        }
+    }
+
+    return !options.filePath.empty();
+}
+
+// Return copy of entries, so that notices can be consumed by merges.
+std::vector<unf::JournalEntry> CopyEntries(
+    const std::vector<unf::JournalEntry>& entries)
+{
+    std::vector<unf::JournalEntry> copies(entries);
+
+    for (auto& entry : copies) {
+        if (entry.notice) {
+            entry.notice = entry.notice->Clone();
+        }
+    }
+
+    return copies;
+}
+
+// Replay entries against broker and return the time spent.
+std::chrono::nanoseconds Replay(
+    const unf::BrokerPtr& broker,
+    std::vector<unf::JournalEntry>& entries,
+    bool originalSpeed)
+{
+    size_t depth = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto& entry : entries) {
+        if (originalSpeed) {
+            std::this_thread::sleep_until(start + entry.time);
+        }
+
+        if (entry.type == unf::JournalEntryType::Notice) {
+            broker->Send(entry.notice);
+        }
+        else if (entry.type == unf::JournalEntryType::BeginTransaction) {
+            broker->BeginTransaction();
+            depth++;
+        }
+        else if (depth > 0) {
+            broker->EndTransaction();
+            depth--;
+        }
+    }
+
+    // Close transactions which were still opened when the journal stopped.
+    for (; depth > 0; --depth) {
+        broker->EndTransaction();
+    }
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+}
+
+double ToMilliseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void PrintStatistics(const unf::BrokerStatistics& statistics)
+{
+    std::printf(
+        "\n%-48s %10s %10s %10s %10s %10s\n",
+        "Notice",
+        "Received",
+        "Captured",
+        "Filtered",
+        "Merged",
+        "Sent");
+
+    for (const auto& notice : statistics.notices) {
+        std::printf(
+            "%-48s %10llu %10llu %10llu %10llu %10llu\n",
+            notice.typeName.c_str(),
+            static_cast<unsigned long long>(notice.received),
+            static_cast<unsigned long long>(notice.captured),
+            static_cast<unsigned long long>(notice.filtered),
+            static_cast<unsigned long long>(notice.merged),
+            static_cast<unsigned long long>(notice.sent));
+    }
+
+    std::printf(
+        "\nCapture: %.3f ms, Merge: %.3f ms, PostProcess: %.3f ms, "
+        "Send: %.3f ms\n",
+        ToMilliseconds(statistics.captureTime),
+        ToMilliseconds(statistics.mergeTime),
+        ToMilliseconds(statistics.postProcessTime),
+        ToMilliseconds(statistics.sendTime));
+
+    if (statistics.latencies.empty()) {
+        return;
+    }
+
+    std::printf(
+        "\n%-48s %-32s %10s %10s %10s %10s\n",
+        "Notice",
+        "Listener",
+        "Count",
+        "p50 (us)",
+        "p99 (us)",
+        "Max (us)");
+
+    for (const auto& latency : statistics.latencies) {
+        std::printf(
+            "%-48s %-32s %10llu %10.1f %10.1f %10.1f\n",
+            latency.typeName.c_str(),
+            latency.listenerName.empty() ? "*" : latency.listenerName.c_str(),
+            static_cast<unsigned long long>(latency.count),
+            ToMilliseconds(latency.p50) * 1000.0,
+            ToMilliseconds(latency.p99) * 1000.0,
+            ToMilliseconds(latency.max) * 1000.0);
+    }
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-h") == 0
+            || std::strcmp(argv[i], "--help") == 0) {
+            std::printf("%s", Usage);
+            return EXIT_SUCCESS;
+        }
+    }
+
+    Options options;
+    if (!ParseArguments(argc, argv, options)) {
+        std::fprintf(stderr, "%s", Usage);
+        return EXIT_FAILURE;
+    }
+
+    // Decode all entries first so that decoding is not measured.
+    std::vector<unf::JournalEntry> entries;
+    size_t noticeCount = 0;
+    {
+        unf::JournalReader reader(options.filePath);
+
+        unf::JournalEntry entry;
+        while (reader.Read(entry)) {
+            if (entry.type == unf::JournalEntryType::Notice) {
+                noticeCount++;
+            }
+            entries.push_back(entry);
+        }
+
+        if (!reader.IsValid()) {
+            std::fprintf(
+                stderr,
+                "Failed to read journal: %s\n",
+                options.filePath.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto stage = PXR_NS::UsdStage::CreateInMemory();
+    auto broker = unf::Broker::Create(stage);
+    broker->SetTimeTracking(true);
+    broker->SetLatencyTracking(options.latency);
+
+    std::chrono::nanoseconds duration{0};
+
+    for (size_t i = 0; i < options.repeat; ++i) {
+        auto copies = CopyEntries(entries);
+        duration += Replay(broker, copies, options.originalSpeed);
+    }
+
+    const double seconds = std::chrono::duration<double>(duration).count();
+    const size_t total = noticeCount * options.repeat;
+
+    std::printf(
+        "Replayed %zu notices in %.3f s (%.1f notices/s)\n",
+        total,
+        seconds,
+        seconds > 0 ? static_cast<double>(total) / seconds : 0.0);
+
+    PrintStatistics(broker->GetStatistics());
+
+    broker->Reset();
+
+    return EXIT_SUCCESS;
+}